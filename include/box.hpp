@@ -28,6 +28,7 @@
 #include "transmitter.hpp"
 #include "directory.hpp"
 #include "hash_tree.hpp"
+#include "reactor.hpp"
 
 class Box : public Transmitter {
  public:
@@ -45,11 +46,14 @@ class Box : public Transmitter {
         const Box& left) const;
 
     int run();
+    int attach(Reactor& reactor);
 
     const std::string getBaseDir() const;
     const std::string getPathOfDirectory(int wd) const;
     const std::string getAbsolutePathOfDirectory(int wd) const;
     const unsigned char* getBoxHash() const;
+    // carries the inotify events of the box to the boxoffice
+    FrameChannel* getChannel() const;
 
     void printDirectories() const;
 
@@ -57,17 +61,16 @@ class Box : public Transmitter {
     void recursiveDirectoryFill(
         std::vector< std::shared_ptr<Hash> >* hashes,
         const std::vector<boost::filesystem::directory_entry>& dir);
+    void sendInotifyEvents(const char* buffer, const ssize_t length);
 
     boost::filesystem::path                     path_;
     std::unordered_map<std::string, Directory*> entries_;
     HashTree*                                   hash_tree_;
     std::unordered_map<int, Directory*>         watch_descriptors_;
     unsigned char*                              box_hash_;
+    FrameChannel*                               bo_channel_;
+    int                                         inotify_fd_;
+    std::vector<char>                           inotify_buffer_;
 };
 
-typedef std::unordered_map< Hash*,
-                            Box*,
-                            hashAsKeyForContainerFunctor,
-                            hashPointerEqualsFunctor > box_map;
-
 #endif  // INCLUDE_BOX_HPP_
@@ -6,10 +6,13 @@
  * publishers to send. 
  * Boxoffice shall only be used within the boxoffice thread. 
  *
- * \TODO heartbeaters+dispatchers probably need info to check if the call
- *       was meant for them. right now all hb+disp would react
- * \TODO boxoffice must be able to handle multiple transmissions of
- *       different boxes
+ * Every box has a session with an FSM of its own, so transmissions of 
+ * different boxes run side by side. The heartbeater lets the busy 
+ * sessions take turns and every box has its own dispatcher. A box has 
+ * F_PIPELINE_LANES sessions, its lanes; pipelined, the next file of a 
+ * box is announced in one lane while the dispatcher sends the data of 
+ * the current file of another. 
+ *
  * \TODO current_box needn't be transmitted, only once. Should be stored
  *       in member variable
  */
@@ -20,18 +23,110 @@
 #include <zmqpp/zmqpp.hpp>
 #include <boost/thread.hpp>
 #include <vector>
-#include <deque>
 #include <utility>
+#include <sstream>
 #include <unordered_map>
 
 #include "file.hpp"
+#include "frame.hpp"
+#include "transfer_journal.hpp"
 #include "box.hpp"
 #include "config.hpp"
+#include "message_schema.hpp"
+#include "clock_sync.hpp"
+#include "reply_set.hpp"
+#include "id_registry.hpp"
+#include "pending_changes.hpp"
+#include "content_hasher.hpp"
 
 namespace fsm {
   #include "flock_fsm.h"
 }
 
+// publishers, subscribers and boxes sharing one reactor thread
+struct reactor_shard_t {
+  std::vector< host_t > hosts;
+  std::vector< node_t > nodes;
+  std::vector< Box* >   boxes;
+};
+
+// FSM state and transfer context of a lane of a box
+struct box_session_t {
+  box_session_t(Hash* box_hash_, Box* box_, uint8_t lane_) :
+    box_hash(box_hash_),
+    box(box_),
+    lane(lane_),
+    disp_channel(s_channel("bo_disp", box_hash_->getBytes())),
+    state(fsm::ready_state),
+    heartbeat_status(fsm::status_100),
+    file_list_metadata(),
+    file_list_data(),
+    current_timing_offset(-1),
+    notified_dispatch(false),
+    current_file(),
+    receiving_file(nullptr),
+    receiving_journal(nullptr),
+    receiving_resumed(false),
+    receiving_delta_base(),
+    receiving_incomplete(false),
+    receiving_holes(),
+    resume_ranges(),
+    resume_full(false),
+    resume_delta_base(),
+    resume_delta_in_place(false),
+    sending_file(nullptr),
+    sending_resends(0),
+    resend_current(false),
+    hashing(nullptr),
+    hashing_file(nullptr),
+    awaiting_state(fsm::NULL_state),
+    awaiting_status(fsm::NULL_status),
+    file_metadata_written(false),
+    stop_sync_timeout_received(false),
+    replied() {}
+
+  Hash*         box_hash;
+  Box*          box;
+  uint8_t       lane;
+  // to the dispatcher of this box
+  FrameChannel* disp_channel;
+  fsm::state_t  state;
+  fsm::status_t heartbeat_status;
+
+  PendingChanges file_list_metadata;
+  PendingChanges file_list_data;
+  uint64_t current_timing_offset;
+  bool notified_dispatch;
+  std::stringstream current_file;
+  File* receiving_file;
+  TransferJournal* receiving_journal;
+  bool receiving_resumed;
+  std::string receiving_delta_base;
+  bool receiving_incomplete;
+  // the holes the received file was announced with
+  std::vector< std::pair<uint64_t, uint64_t> > receiving_holes;
+  std::vector< std::pair<uint64_t, uint64_t> > resume_ranges;
+  bool resume_full;
+  std::string resume_delta_base;
+  bool resume_delta_in_place;
+  File* sending_file;
+  uint32_t sending_resends;
+  bool resend_current;
+  // the job hashing a file of file_list_data, see requestContentHash, 
+  // and the transition waiting for it, see awaitContentHash
+  hash_job_t* hashing;
+  File* hashing_file;
+  fsm::state_t awaiting_state;
+  fsm::status_t awaiting_status;
+  bool file_metadata_written;
+  bool stop_sync_timeout_received;
+  // nodes that replied in the current round, by their node_t index
+  ReplySet replied;
+};
+
+// the lanes of every box, by the index of the box in Boxoffice::box_ids_
+typedef std::vector< std::vector<box_session_t*> > session_map;
+
 class Boxoffice
 {
   public:
@@ -49,22 +144,27 @@ class Boxoffice
 
   private:
     Boxoffice() :
-      state_(fsm::ready_state),
-      file_list_metadata_(),
-      file_list_data_(),
-      current_timing_offset_(-1),
-      notified_dispatch_(false),
-      current_box_(new unsigned char[F_GENERIC_HASH_LEN]),
-      current_file_(),
-      file_metadata_written_(false),
-      stop_sync_timeout_received_(false),
-      current_node_hash_(nullptr),
+      sessions_(),
+      box_ids_(),
+      peer_ids_(),
+      peers_(),
+      journal_dir_(),
+      staging_(false),
+      pipelined_(false),
+      heartbeat_tick_(F_HEARTBEAT_INTERVAL_DEFAULT / F_HEARTBEAT_TICKS),
+      offset_multiplier_(F_OFFSET_MULTIPLIER_DEFAULT),
+      offset_floor_(F_OFFSET_FLOOR_DEFAULT),
+      current_node_index_(0),
+      node_ids_(),
+      clock_(),
+      unpacked_(F_COMPRESSION_MAXIMUM_INPUT),
+      hasher_(),
+      verifying_(),
       z_ctx(nullptr),
       z_bo_main(nullptr),
       z_router(nullptr),
       z_bo_pub(nullptr),
-      z_bo_hb(nullptr),
-      z_bo_disp(nullptr),
+      bo_hb_channel(nullptr),
       z_broadcast(nullptr),
       subscribers(),
       publishers(),
@@ -72,7 +172,10 @@ class Boxoffice
       pub_threads(),
       hb_threads(),
       sub_threads(),
-      box_threads()
+      box_threads(),
+      shards_(),
+      shard_threads(),
+      children_(0)
       {};
     ~Boxoffice();
 
@@ -84,53 +187,103 @@ class Boxoffice
     int setupHeartbeaters();
     int setupDispatchers();
     int setupSubscribers();
+    int setupReactors();
     int checkChildren();
     int runRouter();
     int closeConnections();
 
-    int processEvent(fsm::status_t status, std::stringstream* message);
+    int processEvent(fsm::status_t status, const FrameView& frame);
+    int processEvent(box_session_t& session,
+                     fsm::status_t status,
+                     const FrameView& frame);
     bool checkEvent(fsm::state_t const state,
                     fsm::event_t const event,
                     fsm::status_t const status) const;
-    int performAction(fsm::event_t const event,
+    int performAction(box_session_t& session,
+                      fsm::event_t const event,
                       fsm::action_t const action,
                       fsm::status_t const received_status,
                       fsm::state_t const new_state);
-    int updateHeartbeat(fsm::status_t const new_status,
+    void dispatchFile(box_session_t& session,
+                      fsm::event_t const event,
+                      fsm::status_t const status);
+    int changeState(box_session_t& session,
+                    fsm::event_t const event,
+                    fsm::status_t const status);
+    int updateHeartbeat(box_session_t& session,
+                        fsm::status_t const new_status,
                         fsm::state_t const new_state);
-    void prepareHeartbeatMessage(std::stringstream* message,
+    void prepareHeartbeatMessage(box_session_t& session,
+                                 Frame& message,
                                  fsm::state_t const new_state);
-    int updateTimestamp(std::stringstream* sstream);
+    int updateTimestamp(const FrameView& frame);
+    bool isOwnNode(const uint64_t node_id) const;
+    uint64_t getDeadlineOffset(const uint32_t ticks) const;
+    void collectResumeRanges(box_session_t& session, const FrameView& frame);
+    bool applyMetadataChanges(box_session_t& session,
+                              const msg::MetadataChange& change);
+    box_session_t* findSession(const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                               const uint8_t lane);
+    box_session_t* pickSession(const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                               const std::string& path);
+    void queueLocalChange(box_session_t& session,
+                          PendingChanges& file_list,
+                          File* new_file);
+    void requestContentHash(box_session_t& session);
+    void cancelContentHash(box_session_t& session);
+    bool awaitContentHash(box_session_t& session,
+                          fsm::event_t const event,
+                          fsm::status_t const status);
+    int takeContentHashes();
+    void verifyReceivedFile(box_session_t& session);
+    void finishReceivedFile(hash_job_t* job);
+    void awaitVerification(const Hash* box_hash, const std::string& path);
 
-    fsm::state_t state_;
+    session_map sessions_;
+    IdRegistry box_ids_;
+    IdRegistry peer_ids_;
+    // the node_t of every peer, by its index in peer_ids_
+    std::vector<node_t*> peers_;
 
-    std::deque< File* > file_list_metadata_;
-    std::deque< File* > file_list_data_;
-    uint64_t current_timing_offset_;
-    bool notified_dispatch_;
-    unsigned char* current_box_;
-    std::stringstream current_file_;
-    bool file_metadata_written_;
-    bool stop_sync_timeout_received_;
-    Hash* current_node_hash_;
+    std::string journal_dir_;
+    bool staging_;
+    bool pipelined_;
+    uint32_t heartbeat_tick_;
+    double offset_multiplier_;
+    uint32_t offset_floor_;
+    // node_t index of the sender of the heartbeat being processed
+    size_t current_node_index_;
+    // this node under the names of its publishers, see s_node_id
+    std::vector<uint64_t> node_ids_;
+    ClockSync clock_;
+    // unpacked compressed packages, allocated once
+    std::vector<char> unpacked_;
+    // reads whole files for the announcements and verifications, and 
+    // the verifications it has not handed back yet
+    ContentHasher hasher_;
+    std::vector<hash_job_t*> verifying_;
 
     zmqpp::context* z_ctx;
     zmqpp::socket* z_bo_main;
     zmqpp::socket* z_router;
     zmqpp::socket* z_bo_pub;
-    zmqpp::socket* z_bo_hb;
-    zmqpp::socket* z_bo_disp;
+    FrameChannel*  bo_hb_channel;
     zmqpp::socket* z_broadcast;
 
     node_map              subscribers; // endpoint and type
     std::vector< host_t > publishers;
-    box_map               boxes;
+    // by the index of the box in box_ids_
+    std::vector< Box* >   boxes;
 
     std::vector<boost::thread*> pub_threads;
     std::vector<boost::thread*> hb_threads;
     std::vector<boost::thread*> disp_threads;
     std::vector<boost::thread*> sub_threads;
     std::vector<boost::thread*> box_threads;
+    std::vector<reactor_shard_t> shards_;
+    std::vector<boost::thread*> shard_threads;
+    // transmitters that report as alive and exit, whatever thread they run in
+    int children_;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * \file      buffer_pool.hpp
+ * \brief     Per-thread pool of fixed-size message buffers.
+ *
+ *  Frames are built in buffers from the pool of the building thread
+ *  and handed to zmq without copying; zmq returns them through
+ *  BufferPool::release once the message is sent, possibly from its
+ *  I/O thread. Once every thread has seen its largest burst, sending
+ *  a frame takes no heap allocation.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_BUFFER_POOL_HPP_
+#define INCLUDE_BUFFER_POOL_HPP_
+
+#include <mutex>
+#include <cstddef>
+
+// capacity of a frame, enough for a maximum path and all hole ranges
+#define F_FRAME_BUFFER_SIZE 16384
+// buffers a pool keeps for reuse, further ones are freed
+#define F_BUFFER_POOL_SIZE 32
+
+class BufferPool {
+ public:
+    // pool of the calling thread, created on first use
+    static BufferPool* getInstance();
+
+    char* acquire();
+    void put(char* buffer);
+    // zmq_free_fn, hint is the pool the buffer was acquired from
+    static void release(void* data, void* hint);
+
+    size_t available();
+    size_t allocated();
+
+ private:
+    BufferPool();
+    ~BufferPool();
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // called when the owning thread exits
+    void orphan();
+
+    std::mutex mutex_;
+    char*      free_[F_BUFFER_POOL_SIZE];
+    size_t     available_;
+    size_t     outstanding_;
+    size_t     allocated_;
+    bool       orphaned_;
+
+    friend class BufferPoolOwner;
+};
+
+#endif  // INCLUDE_BUFFER_POOL_HPP_
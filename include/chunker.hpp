@@ -0,0 +1,102 @@
+/**
+ * \file      chunker.hpp
+ * \brief     Content-defined chunking and the chunk store. 
+ *
+ *  The Chunker splits a file into chunks whose boundaries depend on the 
+ *  content only (FastCDC with a gear hash and normalized chunking), so 
+ *  inserting a byte only changes the chunks around it. The ChunkStore 
+ *  is an index from the Blake2 hash of a chunk to a place in a synced 
+ *  file where that chunk can be found, shared by all boxes. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_CHUNKER_HPP_
+#define INCLUDE_CHUNKER_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "constants.hpp"
+#include "prefetcher.hpp"
+
+/**
+ * \brief A chunk of a file and the hash of its content. 
+ */
+struct Chunk {
+  uint64_t      offset;
+  uint64_t      length;
+  unsigned char hash[F_GENERIC_HASH_LEN];
+};
+
+/**
+ * \brief Splits a file into content-defined chunks. 
+ *
+ *  Chunks are between F_CDC_MINIMUM_CHUNK_SIZE and 
+ *  F_CDC_MAXIMUM_CHUNK_SIZE bytes long and 
+ *  F_CDC_AVERAGE_CHUNK_SIZE bytes on average. The file is read 
+ *  sequentially, exactly once, from offset up to size, through the 
+ *  given Prefetcher if any. 
+ */
+class Chunker {
+ public:
+    Chunker(const int fd,
+            const uint64_t size,
+            const uint64_t offset = 0,
+            Prefetcher* prefetcher = nullptr);
+    Chunker(const Chunker&) = delete;
+
+    static uint64_t findBoundary(const unsigned char* data, const uint64_t length);
+
+    bool next(Chunk& chunk, const unsigned char** data);
+
+ private:
+    int                         fd_;
+    Prefetcher*                 prefetcher_;
+    uint64_t                    size_;
+    std::vector<unsigned char>  buffer_;
+    uint64_t                    buffer_offset_;
+    uint64_t                    buffer_length_;
+    uint64_t                    pos_;
+};
+
+/**
+ * \brief Index of all chunks of synced files. 
+ *
+ *  The ChunkStore is a singleton shared by the boxoffice and all 
+ *  dispatcher threads. It does not keep a copy of the data but only 
+ *  where the chunk was last seen, one small file per chunk, so it is 
+ *  safe to use from several threads. A lookup reads the chunk from 
+ *  there and verifies it; stale entries are dropped. 
+ */
+class ChunkStore {
+ public:
+    ChunkStore(const ChunkStore&) = delete;
+    ChunkStore& operator=(const ChunkStore&) = delete;
+
+    static ChunkStore* getInstance() {
+      static ChunkStore cs_instance_;
+      return &cs_instance_;
+    }
+
+    void setDirectory(const std::string& directory);
+
+    void add(const Chunk& chunk, const std::string& path);
+    void addFile(const int fd, const uint64_t size, const std::string& path);
+    bool has(const unsigned char hash[F_GENERIC_HASH_LEN]) const;
+    bool get(const unsigned char hash[F_GENERIC_HASH_LEN],
+             const uint64_t length,
+             std::vector<char>& data) const;
+
+ private:
+    ChunkStore() : directory_() {}
+    ~ChunkStore() {}
+
+    const std::string getEntryPath(const unsigned char hash[F_GENERIC_HASH_LEN]) const;
+
+    std::string directory_;
+};
+
+#endif  // INCLUDE_CHUNKER_HPP_
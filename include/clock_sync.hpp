@@ -0,0 +1,66 @@
+/**
+ * \file      clock_sync.hpp
+ * \brief     Clock offset and delay estimates of the nodes of a flock.
+ *
+ *  Every heartbeat tells how long it took from the node to us, its
+ *  clock offset included, and reports how long our last heartbeat took
+ *  to the node. Half the difference of both is the offset of the clock
+ *  of the node, their sum the round trip, as in NTP. Single samples are
+ *  skewed by queueing, so the sample with the smallest round trip of
+ *  the last F_CLOCK_SYNC_WINDOW ones is taken as the estimate.
+ *
+ *  Deadlines are exchanged in flock time, the median of the clocks of
+ *  all nodes. Every node derives the same flock time from its own
+ *  estimates, so no node has to be trusted to serve the time.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_CLOCK_SYNC_HPP_
+#define INCLUDE_CLOCK_SYNC_HPP_
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "constants.hpp"
+
+/**
+ * \brief Filtered clock offsets and round trips per node.
+ *
+ *  Nodes are named by their s_node_id. Offsets are the local clock
+ *  minus the clock of the node in ms.
+ */
+class ClockSync {
+ public:
+    ClockSync();
+
+    void addSample(const uint64_t node, const int64_t delay_in, const int64_t delay_out);
+
+    bool has(const uint64_t node) const;
+    int64_t getOffset(const uint64_t node) const;
+    int64_t getDelay(const uint64_t node) const;
+    int64_t getConsensusOffset() const;
+
+    uint64_t toFlockTime(const uint64_t local) const;
+    uint64_t toLocalTime(const uint64_t flock) const;
+
+ private:
+    struct sample_t {
+      int64_t offset;
+      int64_t delay;
+    };
+    struct node_clock_t {
+      std::vector<sample_t> samples;
+      size_t                next;
+      sample_t              estimate;
+    };
+
+    void updateConsensus();
+
+    std::unordered_map<uint64_t, node_clock_t> nodes_;
+    int64_t                                    consensus_;
+};
+
+#endif  // INCLUDE_CLOCK_SYNC_HPP_
@@ -0,0 +1,39 @@
+/**
+ * \file      compression.hpp
+ * \brief     Compression of literal file data packages. 
+ *
+ *  File data packages always have the same size on the wire. For data 
+ *  that compresses well, a package can carry several times 
+ *  F_MAXIMUM_FILE_PACKAGE_SIZE bytes of the file instead of padding. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_COMPRESSION_HPP_
+#define INCLUDE_COMPRESSION_HPP_
+
+#include <string>
+#include <cstdint>
+
+#include "constants.hpp"
+
+/**
+ * \brief Packs literal file data into a single package. 
+ *
+ *  Uses zlib at its fastest level. A packed payload is the length of 
+ *  the compressed data followed by the data itself and never exceeds 
+ *  F_MAXIMUM_FILE_PACKAGE_SIZE bytes. 
+ */
+class Compression {
+ public:
+    static uint64_t pack(const char* data,
+                         const uint64_t length,
+                         std::string& packed);
+    static bool unpack(const char* packed,
+                       const uint64_t packed_length,
+                       char* data,
+                       const uint64_t length);
+};
+
+#endif  // INCLUDE_COMPRESSION_HPP_
@@ -44,9 +44,39 @@ class Config
         getHostKeypair() const;
     const std::map< std::string, box_t >
         getBoxes() const;
+    bool
+        getStaging() const;
+    bool
+        getCompression() const;
+    uint32_t
+        getFsyncInterval() const;
+    uint32_t
+        getReactorThreads() const;
+    bool
+        getPipelined() const;
+    uint32_t
+        getHeartbeatInterval() const;
+    double
+        getOffsetMultiplier() const;
+    uint32_t
+        getOffsetFloor() const;
+    const std::string
+        getJournalDir() const;
+    const std::string
+        getChunkStoreDir() const;
 
   private:
-    Config() {};
+    Config() :
+      staging_(false),
+      compression_(F_COMPRESSION_DEFAULT),
+      fsync_interval_(F_FSYNC_INTERVAL_DEFAULT),
+      reactor_threads_(F_REACTOR_THREADS_DEFAULT),
+      pipelined_(F_PIPELINE_DEFAULT),
+      heartbeat_interval_(F_HEARTBEAT_INTERVAL_DEFAULT),
+      offset_multiplier_(F_OFFSET_MULTIPLIER_DEFAULT),
+      offset_floor_(F_OFFSET_FLOOR_DEFAULT),
+      journal_dir_(F_JOURNAL_DIR),
+      chunk_store_dir_(F_CHUNK_STORE_DIR) {};
     ~Config() {};
 
     int doSanityCheck(boost::program_options::options_description* options, 
@@ -65,6 +95,16 @@ class Config
     node_map                         nodes_;
     std::vector< host_t >            hosts_;
     std::map< std::string, box_t >   boxes_;
+    bool                             staging_;
+    bool                             compression_;
+    uint32_t                         fsync_interval_;
+    uint32_t                         reactor_threads_;
+    bool                             pipelined_;
+    uint32_t                         heartbeat_interval_;
+    double                           offset_multiplier_;
+    uint32_t                         offset_floor_;
+    std::string                      journal_dir_;
+    std::string                      chunk_store_dir_;
 
 //    int                                        config_backup_type_;
 //    boost::filesystem::path                    backup_dir_;
@@ -14,16 +14,23 @@
 #include <unistd.h>
 #include <sys/inotify.h>
 #include <ctime>
+#include <climits>
+#include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 #include <hash.hpp>
+#include <frame.hpp>
+#include <spsc_ring.hpp>
 
 enum F_SIGTYPE {
   F_SIGTYPE_LIFE,
   F_SIGTYPE_PUB,
   F_SIGTYPE_SUB,
   F_SIGTYPE_INOTIFY,
-  F_SIGTYPE_FSM
+  F_SIGTYPE_FSM,
+  // heartbeat delays measured by the boxoffice, for the heartbeater
+  F_SIGTYPE_CLOCK
 };
 enum F_SIGLIFE {
   F_SIGLIFE_ALIVE,
@@ -56,18 +63,91 @@ enum F_BACKUP_TYPE {
 #define F_IN_BUF_LEN    (1024 * (F_IN_EVENT_SIZE + 16))
 #define F_IN_EVENT_MASK  IN_ATTRIB|IN_CREATE|IN_DELETE|IN_DELETE_SELF|IN_MODIFY|IN_MOVE|IN_MOVE_SELF
 
-#define F_MINIMUM_HB_WIDTH 256
-#define F_MINIMUM_SEND_OFFSET 3000
-#define F_MAXIMUM_SEND_OFFSET 6000
-#define F_MINIMUM_STOP_OFFSET 1000
-#define F_MAXIMUM_STOP_OFFSET 2000
+// milliseconds per heartbeat interval, and heartbeats sent in each
+#define F_HEARTBEAT_INTERVAL_DEFAULT 1000
+#define F_HEARTBEAT_TICKS 10
+// deadlines of transfers and stops allow for this many heartbeat ticks 
+// plus the round trips to the nodes, times the multiplier; round trips 
+// not measured yet count as F_OFFSET_UNKNOWN_RTT
+#define F_SEND_OFFSET_TICKS 2
+#define F_STOP_OFFSET_TICKS 1
+#define F_OFFSET_MULTIPLIER_DEFAULT 3.0
+#define F_OFFSET_FLOOR_DEFAULT 250
+#define F_OFFSET_UNKNOWN_RTT 1000
+// heartbeats per node the clock offset is filtered over
+#define F_CLOCK_SYNC_WINDOW 16
 
 #define F_CONFIG_FILE "~/.flocksy"
 #define F_KEYSTORE_FILE "~/.ssh/flocksy_keystore"
 #define F_PRIVATEKEY_FILE "~/.ssh/flocksy_privatekeys"
 
-#define F_MAXIMUM_PATH_LENGTH 128
+#define F_MAXIMUM_PATH_LENGTH PATH_MAX
+// paths up to this length are stored without an allocation
+#define F_INLINE_PATH_LENGTH 64
 #define F_MAXIMUM_FILE_PACKAGE_SIZE 4096
+// all file data packages are padded to this length
+#define F_FILE_PACKAGE_LEN (F_FRAME_HEADER_LEN + F_MAXIMUM_FILE_PACKAGE_SIZE)
+// every heartbeat is padded to exactly this length, whatever its status, 
+// so its size does not tell what a node is doing; it is the length of a 
+// file data package, so heartbeats and data look alike too. Payloads 
+// that do not fit are split or refused
+#define F_HEARTBEAT_PAYLOAD_LEN F_MAXIMUM_FILE_PACKAGE_SIZE
+#define F_HEARTBEAT_LEN (F_FRAME_HEADER_LEN + F_HEARTBEAT_PAYLOAD_LEN)
+
+// staged files are received next to their target under this prefix
+#define F_STAGING_PREFIX ".flocksy-staging."
+// milliseconds between two grouped fsyncs of received files
+#define F_FSYNC_INTERVAL_DEFAULT 1000
+
+// transfer journals of partially received files
+#define F_JOURNAL_DIR "~/.flocksy_journal"
+#define F_JOURNAL_SYNC_CHUNKS 64
+#define F_MAXIMUM_RESUME_RANGES 16
+#define F_CONTENT_HASH_BLOCK_SIZE 65536
+
+// delta transfers of modified files
+#define F_DELTA_MINIMUM_BLOCK_SIZE 1024
+#define F_DELTA_MAXIMUM_BLOCK_SIZE 131072
+#define F_DELTA_STRONG_HASH_LEN 16
+
+// content-defined chunking of new files
+#define F_CHUNK_STORE_DIR "~/.flocksy_chunks"
+#define F_CDC_MINIMUM_CHUNK_SIZE 2048
+#define F_CDC_AVERAGE_CHUNK_SIZE 8192
+#define F_CDC_MAXIMUM_CHUNK_SIZE 65536
+#define F_MAXIMUM_RESENDS 2
+// offset, length, source offset and hash of a chunk reference
+#define F_CHUNK_REFERENCE_LEN (8 + 8 + 8 + F_GENERIC_HASH_LEN)
+#define F_CHUNK_NO_SOURCE UINT64_MAX
+
+// compression of literal file data
+#define F_COMPRESSION_DEFAULT false
+#define F_COMPRESSION_MAXIMUM_INPUT (16 * F_MAXIMUM_FILE_PACKAGE_SIZE)
+// data compressing worse than this is sent as it is
+#define F_COMPRESSION_MINIMUM_RATIO 0.9
+
+// read-ahead of outgoing file data
+#define F_PREFETCH_DEPTH 8
+#define F_PREFETCH_BLOCK_SIZE 65536
+
+// sessions per box; pipelined, the next file of a box is announced
+// while the data of the current one is being sent
+#define F_PIPELINE_LANES 2
+#define F_PIPELINE_DEFAULT false
+
+// metadata changes sent in one heartbeat, at most this many records, 
+// as many as fit into F_HEARTBEAT_PAYLOAD_LEN
+#define F_METADATA_BATCH_SIZE 256
+
+// frames queued on a channel between two threads
+#define F_CHANNEL_CAPACITY 1024
+
+// threads shared by publishers, subscribers and boxes, 0 for a thread each
+#define F_REACTOR_THREADS_DEFAULT 0
+
+// sparse files, smaller holes are sent as data
+#define F_MINIMUM_HOLE_SIZE 65536
+#define F_MAXIMUM_HOLE_RANGES 64
 
 // Box configuration parameters
 enum F_SYMLINK_HANDLING {
@@ -84,10 +164,11 @@ struct node_t {
   std::string   endpoint;
   int           f_subtype;
   int64_t       last_timestamp;
-  int16_t       offset;
+  // dense from 0, assigned by the IdRegistry of the Boxoffice, for 
+  // flat arrays and bitmaps over all nodes, see ReplySet
+  size_t        index;
   std::string   public_key;
   unsigned char uid[F_GENERIC_HASH_LEN];
-  bool          replied;
 };
 struct host_t {
   std::string           endpoint;
@@ -106,20 +187,27 @@ typedef std::unordered_map< Hash*,
                             hashAsKeyForContainerFunctor,
                             hashPointerEqualsFunctor > node_map;
 
-// wrapper for polling on one socket while simultaneously polling the broadcast
-void s_recv(zmqpp::socket &socket, zmqpp::socket &broadcast, std::stringstream &sstream);
-void s_recv(zmqpp::socket &socket,
-            zmqpp::socket &broadcast,
-            zmqpp::socket &heartbeat,
-            std::stringstream &sstream);
-void s_recv(zmqpp::socket &socket,
-            zmqpp::socket &broadcast,
-            zmqpp::socket &heartbeat,
-            zmqpp::socket &dispatch,
-            std::stringstream &sstream);
-// wrapper for polling on three sockets, but non-blocking
-int s_recv_noblock(zmqpp::socket &socket, zmqpp::socket &socket2, zmqpp::socket &broadcast, std::stringstream &sstream, int timeout);
-// wrapper for polling on inotify event while simultaneously polling the broadcast
-void s_recv_in(zmqpp::socket &broadcast, zmqpp::socket &socket, int fd, std::stringstream &sstream);
+// sends a frame as a single message part, handing its buffer to zmq
+void s_send(zmqpp::socket &socket, Frame &frame, const bool dont_block = false);
+void s_send(zmqpp::socket &socket, Frame &&frame, const bool dont_block = false);
+// view of the frame in the first part of a received message
+FrameView s_frame(const zmqpp::message &z_msg);
+// names a node by the first bytes of its hash, e.g. in delay reports
+uint64_t s_node_id(const unsigned char node[F_GENERIC_HASH_LEN]);
+
+// channels between two threads of this process, looked up by name like 
+// inproc endpoints; each has exactly one sending and one receiving thread,
+// so every host's publisher reads from channels named after its endpoint
+typedef SpscRing<Frame, F_CHANNEL_CAPACITY> FrameChannel;
+FrameChannel* s_channel(const std::string &name);
+// the channel of that name belonging to a box
+FrameChannel* s_channel(const std::string &name,
+                        const unsigned char box_hash[F_GENERIC_HASH_LEN]);
+// moves a frame onto a channel, waiting while it is full unless dont_block
+void s_send(FrameChannel &channel, Frame &frame, const bool dont_block = false);
+void s_send(FrameChannel &channel, Frame &&frame, const bool dont_block = false);
+// puts a copy of the frame onto every channel and the frame itself onto 
+// the last one, e.g. for the publishers of all hosts
+void s_send(const std::vector<FrameChannel*> &channels, Frame &frame, const bool dont_block = false);
 
 #endif
\ No newline at end of file
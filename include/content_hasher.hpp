@@ -0,0 +1,108 @@
+/**
+ * \file      content_hasher.hpp
+ * \brief     Hashing and verification of whole files off the router. 
+ *
+ *  Announcing a file needs its content hash, finishing a received one 
+ *  its signature, its verification and its chunks. All of them read 
+ *  the complete file, which would stall every other session of the 
+ *  boxoffice for as long as the disk takes. A ContentHasher does the 
+ *  reading in a separate thread and hands the results back through an 
+ *  SpscRing the boxoffice polls. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_CONTENT_HASHER_HPP_
+#define INCLUDE_CONTENT_HASHER_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+#include "constants.hpp"
+#include "hash.hpp"
+#include "file.hpp"
+#include "delta.hpp"
+#include "transfer_journal.hpp"
+#include "spsc_ring.hpp"
+
+/**
+ * \brief A file to be hashed or verified, and the outcome. 
+ *
+ *  To hash, the job names the file by its box and metadata record; the 
+ *  content hash and the holes it is announced with are filled in. To 
+ *  verify, the job takes over a received file and its journal and 
+ *  reports whether the data matches the announced content hash, along 
+ *  with the signature of the new version. Only cancelled is touched by 
+ *  both threads while the job is out. 
+ */
+struct hash_job_t {
+  enum kind_t {
+    hash = 0,
+    verify = 1
+  };
+
+  hash_job_t() : kind(hash), box(0), lane(0), box_dir(), box_hash(nullptr),
+                 record(), max_holes(0), file(nullptr), journal(nullptr),
+                 holes(), ok(false), content_hash(), signature(), cancelled(false) {}
+  hash_job_t(const hash_job_t&) = delete;
+
+  kind_t            kind;
+  uint32_t          box;
+  uint8_t           lane;
+  std::string       box_dir;
+  Hash*             box_hash;
+  // hash: the record of the file as it is announced
+  std::string       record;
+  size_t            max_holes;
+  // verify: owned by the job until it is taken back
+  File*             file;
+  TransferJournal*  journal;
+  // the holes the content hash covers
+  std::vector< std::pair<uint64_t, uint64_t> > holes;
+  bool              ok;
+  unsigned char     content_hash[F_GENERIC_HASH_LEN];
+  Signature         signature;
+  std::atomic<bool> cancelled;
+};
+
+/**
+ * \brief Runs hash_job_t in a separate thread. 
+ *
+ *  Jobs are submitted and taken back by one thread only. fd() becomes 
+ *  readable when finished jobs are waiting; clearWakeup() before 
+ *  draining them with take(). Cancelled jobs are returned untouched. 
+ *  If too many jobs are out already, submit() fails and the caller may 
+ *  run() the job itself. 
+ */
+class ContentHasher {
+ public:
+    ContentHasher();
+    ContentHasher(const ContentHasher&) = delete;
+    ~ContentHasher();
+
+    void start();
+    void stop();
+
+    bool submit(hash_job_t* job);
+    bool take(hash_job_t*& job);
+    int fd() const;
+    void clearWakeup();
+
+    static void run(hash_job_t& job);
+
+ private:
+    void work();
+    void discard();
+
+    SpscRing<hash_job_t*, F_CHANNEL_CAPACITY> requests_;
+    SpscRing<hash_job_t*, F_CHANNEL_CAPACITY> results_;
+    std::atomic<bool>                         stopped_;
+    std::thread                               worker_;
+};
+
+#endif  // INCLUDE_CONTENT_HASHER_HPP_
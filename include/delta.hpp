@@ -0,0 +1,152 @@
+/**
+ * \file      delta.hpp
+ * \brief     Block signatures and delta encoding of modified files. 
+ *
+ *  A Signature describes a version of a file by a rolling weak checksum 
+ *  and a short Blake2 hash of each of its blocks. Given the Signature of 
+ *  the version a receiver already has, the DeltaEncoder turns the 
+ *  current version of the file into copy instructions for blocks the 
+ *  receiver already has and literal data for everything else. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_DELTA_HPP_
+#define INCLUDE_DELTA_HPP_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+#include <sodium.h>
+
+#include "constants.hpp"
+#include "prefetcher.hpp"
+
+/**
+ * \brief One step of a delta: either literal data to be written at 
+ *  offset or length bytes to be copied from source to offset. 
+ */
+struct DeltaInstruction {
+  // also the kind of a file data package; packages of references to
+  // content-defined chunks have no instruction of their own
+  enum op_t : uint8_t {
+    literal    = 0,
+    copy       = 1,
+    references = 2,
+    compressed = 3,
+    hole = 4
+  };
+  op_t        op;
+  uint64_t    offset;
+  uint64_t    source;
+  uint64_t    length;
+  std::string data;
+};
+
+/**
+ * \brief Block signatures of one version of a file. 
+ *
+ *  Signatures are built incrementally by begin(), update() and finish(), 
+ *  so they can be computed while the file is read anyway. They are 
+ *  stored next to the transfer journals, named after the box and the 
+ *  path of the file. 
+ */
+class Signature {
+ public:
+    Signature();
+
+    static uint64_t getBlockSize(const uint64_t size);
+    static uint32_t weakChecksum(const unsigned char* data, const uint64_t length);
+    static uint32_t rollChecksum(const uint32_t checksum,
+                                 const unsigned char out,
+                                 const unsigned char in,
+                                 const uint64_t length);
+    static void strongHash(const unsigned char* data,
+                           const uint64_t length,
+                           unsigned char hash[F_DELTA_STRONG_HASH_LEN]);
+    static const std::string getSignaturePath(const std::string& journal_dir,
+                                              const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                                              const std::string& path);
+
+    void begin(const uint64_t size, const uint32_t mtime);
+    void update(const unsigned char* data, uint64_t length);
+    void finish();
+
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+    bool matches(const uint64_t size, const uint32_t mtime) const;
+    uint64_t getSize() const;
+    uint32_t getMtime() const;
+    uint64_t getBlockSize() const;
+    uint64_t getBlockCount() const;
+    uint64_t getBlockLength(const uint64_t index) const;
+    uint32_t getWeak(const uint64_t index) const;
+    const unsigned char* getStrong(const uint64_t index) const;
+    const unsigned char* getContentHash() const;
+
+ private:
+    uint64_t                    size_;
+    uint32_t                    mtime_;
+    uint64_t                    block_size_;
+    std::vector<uint32_t>       weak_;
+    std::vector<unsigned char>  strong_;
+    unsigned char               content_hash_[F_GENERIC_HASH_LEN];
+    crypto_generichash_state    state_;
+    std::vector<unsigned char>  block_;
+};
+
+/**
+ * \brief Computes the delta of a file against the Signature of an 
+ *  older version. 
+ *
+ *  Instructions are returned in order of their target offset. If the 
+ *  receiver applies them in place, copies are only ever made from 
+ *  offsets at or behind their target, so no block is overwritten 
+ *  before it has been copied. Adjacent copies are merged. While the 
+ *  file is scanned, the Signature of the new version is built as well. 
+ *  The file is read through the given Prefetcher if any. 
+ */
+class DeltaEncoder {
+ public:
+    DeltaEncoder(const int fd,
+                 const uint64_t size,
+                 const uint32_t mtime,
+                 const Signature& base,
+                 const bool in_place,
+                 Prefetcher* prefetcher = nullptr);
+    DeltaEncoder(const DeltaEncoder&) = delete;
+
+    bool next(DeltaInstruction& instruction);
+    const Signature& getSignature() const;
+
+ private:
+    bool fill(const uint64_t end);
+    bool findBlock(const uint64_t length, uint64_t& source);
+    void pushCopy();
+    void pushLiteral();
+
+    int                                         fd_;
+    Prefetcher*                                 prefetcher_;
+    uint64_t                                    size_;
+    const Signature&                            base_;
+    bool                                        in_place_;
+    Signature                                   signature_;
+    std::unordered_multimap<uint32_t, uint64_t> index_;
+    std::vector<unsigned char>                  buffer_;
+    uint64_t                                    buffer_offset_;
+    uint64_t                                    buffer_length_;
+    uint64_t                                    pos_;
+    uint64_t                                    literal_start_;
+    uint32_t                                    weak_;
+    bool                                        weak_valid_;
+    bool                                        has_copy_;
+    DeltaInstruction                            copy_;
+    std::deque<DeltaInstruction>                queue_;
+    bool                                        done_;
+};
+
+#endif  // INCLUDE_DELTA_HPP_
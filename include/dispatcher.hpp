@@ -1,18 +1,28 @@
 /**
- * Each publisher has its own dispatcher thread that calls upon the 
+ * Each box has its own dispatcher thread that calls upon the 
  * publisher to send out the data of a file once a filedata transfer 
  * has been scheduled. At the time of transmission, it shall send
  * packages of data as specified in the protocol to the publisher. Each 
  * dispatcher shall be initialized and managed by the boxoffice. 
- * For each dispatcher there shall be a separate dispatcher thread. 
+ * For each dispatcher there shall be a separate dispatcher thread, so 
+ * a large transfer in one box does not hold up the others. The lanes 
+ * of a box share its dispatcher, which sends their files one after the 
+ * other. 
  */
 
 #ifndef F_DISPATCHER_HPP
 #define F_DISPATCHER_HPP
 
+#include <string>
+#include <vector>
+#include <deque>
 #include <zmqpp/zmqpp.hpp>
 
 #include "transmitter.hpp"
+#include "file.hpp"
+#include "delta.hpp"
+#include "prefetcher.hpp"
+#include "reactor.hpp"
 
 namespace fsm {
   #include "flock_fsm.h"
@@ -23,13 +33,31 @@ class Dispatcher : public Transmitter
   public:
     Dispatcher() :
       Transmitter(),
-      z_dispatcher(nullptr),
-      z_boxoffice_disp_push(nullptr),
+      pub_disp_channels(),
+      bo_disp_channel(nullptr),
+      box_hash_(),
+      lane_(0),
+      deferred_(),
+      held_(),
+      z_msg_(),
       current_status_(fsm::status_100),
       timing_offset_(-1),
-      waiting_for_stop_(false)
+      timing_deadline_(0),
+      waiting_for_stop_(false),
+      compression_(false),
+      literals_(),
+      literals_offset_(0),
+      has_pending_(false),
+      pending_offset_(0),
+      pending_length_(0),
+      pending_op_(DeltaInstruction::literal),
+      pending_data_(),
+      packed_(),
+      read_buffer_(F_COMPRESSION_MAXIMUM_INPUT)
       {};
-    Dispatcher(zmqpp::context* z_ctx_, fsm::status_t status);
+    Dispatcher(zmqpp::context* z_ctx_,
+               fsm::status_t status,
+               const unsigned char box_hash[F_GENERIC_HASH_LEN]);
     Dispatcher(const Dispatcher&);
     ~Dispatcher();
 
@@ -38,14 +66,73 @@ class Dispatcher : public Transmitter
   private:
     int connectToPublisher();
     int connectToBoxofficeDispatcher();
-    int synchronizingStop();
+    int receive(Reactor& reactor,
+                FrameView& frame,
+                const long timeout,
+                const bool any_lane);
+    int receiveResumeRanges(Reactor& reactor,
+                            std::vector< std::pair<uint64_t, uint64_t> >& ranges,
+                            std::string& delta_base,
+                            bool& delta_in_place);
+    void sendRanges(File* file,
+                    const std::vector< std::pair<uint64_t, uint64_t> >& ranges);
+    void sendDelta(const std::string& box_dir,
+                   File* file,
+                   const Signature& base,
+                   const bool in_place,
+                   Signature& signature);
+    void sendChunks(const std::string& box_dir,
+                    File* file,
+                    Signature& signature);
+    void queuePackage(const uint64_t offset,
+                      const uint64_t length,
+                      const uint8_t op,
+                      std::string& data);
+    void queueData(Prefetcher& prefetcher, uint64_t offset, const uint64_t end);
+    void queueHole(const uint64_t offset, const uint64_t length);
+    void queueLiteral(const uint64_t offset,
+                      const char* data,
+                      const uint64_t length);
+    void packLiterals(const bool all);
+    void flushPackages();
+    void sendDataPackage(const uint64_t offset,
+                         const uint64_t length,
+                         const bool more,
+                         const uint8_t op,
+                         const char* data,
+                         const uint64_t data_length) const;
+    int synchronizingStop(Reactor& reactor);
     void sendFakeData() const;
 
-    zmqpp::socket* z_dispatcher;
-    zmqpp::socket* z_boxoffice_disp_push;
+    // to the publisher of every host
+    std::vector<FrameChannel*> pub_disp_channels;
+    FrameChannel*  bo_disp_channel;
+    // all packages are tagged with the box, see Boxoffice::findSession
+    unsigned char  box_hash_[F_GENERIC_HASH_LEN];
+    // the lane of the current transfer and the frames of other lanes 
+    // that came in meanwhile
+    uint8_t        lane_;
+    std::deque<Frame> deferred_;
+    Frame          held_;
+    zmqpp::message z_msg_;
     fsm::status_t  current_status_;
     uint64_t       timing_offset_;
+    uint64_t       timing_deadline_;
     bool           waiting_for_stop_;
+    bool           compression_;
+
+    // the package held back and the literals not yet packed of the
+    // current transfer
+    std::string    literals_;
+    uint64_t       literals_offset_;
+    bool           has_pending_;
+    uint64_t       pending_offset_;
+    uint64_t       pending_length_;
+    uint8_t        pending_op_;
+    std::string    pending_data_;
+    // reused for every package, so a transfer allocates once
+    std::string    packed_;
+    std::vector<char> read_buffer_;
 };
 
 #endif
\ No newline at end of file
@@ -17,12 +17,17 @@
 #define INCLUDE_FILE_HPP_
 
 #include <string>
-#include <array>
+#include <vector>
+#include <utility>
 #include <ios>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
 #include "constants.hpp"
 #include "hash.hpp"
+#include "delta.hpp"
+#include "chunker.hpp"
+#include "small_string.hpp"
+#include "path_codec.hpp"
 
 /**
  * \brief Class for File-IO. 
@@ -72,8 +77,8 @@ class File {
          const std::string& path,
          const bool create,
          const bool deleted_file);
-    // Since the copy-constructor of std::fstream is explicitly deleted,
-    // this Class' copy-constructor should also be explicitly deleted
+    // Since a File owns an open file descriptor while transferring data,
+    // this Class' copy-constructor should be explicitly deleted
     File(const File& f) = delete;
     ~File();
 
@@ -87,13 +92,19 @@ class File {
 
     void setMode(boost::filesystem::perms mode);
     void setMtime(uint32_t mtime);
+    void setStaging(bool staging);
+    void setHoles(const std::vector< std::pair<uint64_t, uint64_t> >& holes);
     void storeMetadata() const;
     void resize(uint64_t const size);
     void resize();
+    void truncate();
     void create();
+    void remove() const;
 
     void openFile();
     void closeFile();
+    int getFileDescriptor();
+    void prefetch(const uint64_t length);
 
     uint64_t readFileData(char* data,
                          const uint64_t size,
@@ -101,6 +112,8 @@ class File {
                          bool* more);
     uint64_t readFileData(char* data, uint64_t offset);
     uint64_t readFileData(char* data, uint64_t offset, bool* more);
+    std::vector< std::pair<uint64_t, uint64_t> > getDataRanges();
+    std::vector< std::pair<uint64_t, uint64_t> > getHoles(const size_t max_count);
 
     void storeFileData(const char* data,
                        const int64_t size,
@@ -108,18 +121,40 @@ class File {
     void storeFileData(const char* data,
                        const uint64_t size,
                        const uint64_t offset);
+    bool copyFileData(const uint64_t source,
+                      const uint64_t size,
+                      const uint64_t offset);
+    bool storeChunk(const Chunk& chunk, const uint64_t source);
+    bool punchHole(const uint64_t offset, const uint64_t length);
+    bool finishFileData(const unsigned char* content_hash = nullptr);
+    void getContentHash(unsigned char hash[F_GENERIC_HASH_LEN]);
+    void getSignature(Signature& signature, unsigned char* content_hash = nullptr);
+    void indexChunks();
+
+    void prepareAnnouncement(const size_t max_count);
+    void setAnnouncement(const unsigned char content_hash[F_GENERIC_HASH_LEN],
+                         const std::vector< std::pair<uint64_t, uint64_t> >& holes);
+    const unsigned char* getAnnouncedContentHash() const;
+    const std::vector< std::pair<uint64_t, uint64_t> >& getAnnouncedHoles() const;
+
+    void serialize(std::ostream& ostream, PathCodec& codec) const;
+    void deserialize(std::istream& istream, PathCodec& codec);
 
  private:
     std::string                              box_path_;
     Hash*                                    box_hash_;
     boost::filesystem::path                  bpath_;
-    std::array<char, F_MAXIMUM_PATH_LENGTH> path_;
+    SmallString<F_INLINE_PATH_LENGTH>        path_;
     boost::filesystem::perms                 mode_;
     uint32_t                                 mtime_;
     boost::filesystem::file_type             type_;
     uint64_t                                 size_;
     bool                                     deleted_file_;
-    std::fstream                             fstream_;
+    bool                                     staging_;
+    std::vector< std::pair<uint64_t, uint64_t> > holes_;
+    unsigned char                            content_hash_[F_GENERIC_HASH_LEN];
+    bool                                     announced_;
+    int                                      fd_;
 
     void checkArguments(const std::string& path,
                         const boost::filesystem::file_type type,
@@ -129,6 +164,9 @@ class File {
 
     const std::string constructPath(const std::string box_path,
                                     const std::string path) const;
+    void preallocate();
+    void hashContent(Signature* signature, unsigned char* content_hash);
+    const boost::filesystem::path getStagingPath() const;
 
     friend std::ostream& operator<<(std::ostream& ostream, const File& f);
     friend std::istream& operator>>(std::istream& istream, File& f);
@@ -6,15 +6,12 @@
  * \date        2016
  * \copyright   GNU Public License v3 or higher. 
  *
- *  ** WARNING *************************************************************
- *  THIS SOURCE FILE IS 100% GENERATED. If you edit this file, you will lose
- *  your changes at the next build cycle. This is great for temporary printf
- *  statements. DO NOT MAKE ANY CHANGES YOU WISH TO KEEP. The correct places
- *  for commits are:
- *
- *   * The XML model used for this code generation: flock_fsm.xml, or
- *   * The code generation script that built this file: fsm_c.gsl
- *  ************************************************************************
+ *  The tables in this file were first generated by a GSL script from an
+ *  XML model of the Flock state machine. That generator is retired and
+ *  not part of this repository; the tables are maintained by hand now.
+ *  test/test_flock_fsm.cpp checks every transition against the original
+ *  generated header in test/flock_fsm_reference.h; a change of the protocol
+ *  has to be made in both.
  */
 
 #ifndef FLOCK_FSM_H_
@@ -151,2788 +148,461 @@ typedef enum {
     exit_action = 7
 } action_t;
 
+//  ---------------------------------------------------------------------------
+//  State machine tables
+//
+//  Every lookup is a fixed number of array accesses. A status code is mapped
+//  to its index first; (state, event) selects a row of transitions, which is
+//  indexed by that status index. Identical rows and transitions are stored
+//  once, index 0 always stands for "no transition".
+
+#define FSM_STATE_COUNT 30
+#define FSM_EVENT_COUNT 20
+#define FSM_STATUS_COUNT 54
+#define FSM_STATUS_CODE_LIMIT 501
+#define FSM_TRANSITION_COUNT 71
+#define FSM_TRANSITION_ROW_COUNT 137
+
+typedef struct {
+    action_t action;
+    status_t heartbeat_status;
+    state_t  new_state;
+} transition_t;
+
+//  index of every status code, 0 for codes that are not in use
+static constexpr unsigned char status_index_table[FSM_STATUS_CODE_LIMIT] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 0
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 20
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 40
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 60
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 80
+     1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  3,  4,  5,  6,  7,  8,  9,  0,  0,  // 100
+    10, 11, 12,  0, 13, 14, 15,  0,  0,  0, 16, 17, 18,  0, 19, 20, 21,  0,  0,  0,  // 120
+    22, 23, 24,  0,  0, 25, 26, 27,  0,  0, 28,  0,  0,  0,  0, 29, 30,  0,  0,  0,  // 140
+    31, 32, 33,  0, 34, 35, 36,  0,  0,  0, 37, 38, 39, 40, 41, 42,  0, 43, 44,  0,  // 160
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 180
+    45,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 200
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 220
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 240
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 260
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 280
+    47, 48,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 300
+    50,  0,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 320
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 340
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 360
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 380
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 400
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 420
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 440
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 460
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  // 480
+    53  // 500
+};
+
+static constexpr status_t status_code_table[FSM_STATUS_COUNT] = {
+    NULL_status,
+    status_100,
+    status_110,
+    status_111,
+    status_112,
+    status_113,
+    status_114,
+    status_115,
+    status_116,
+    status_117,
+    status_120,
+    status_121,
+    status_122,
+    status_124,
+    status_125,
+    status_126,
+    status_130,
+    status_131,
+    status_132,
+    status_134,
+    status_135,
+    status_136,
+    status_140,
+    status_141,
+    status_142,
+    status_145,
+    status_146,
+    status_147,
+    status_150,
+    status_155,
+    status_156,
+    status_160,
+    status_161,
+    status_162,
+    status_164,
+    status_165,
+    status_166,
+    status_170,
+    status_171,
+    status_172,
+    status_173,
+    status_174,
+    status_175,
+    status_177,
+    status_178,
+    status_200,
+    status_210,
+    status_300,
+    status_301,
+    status_304,
+    status_320,
+    status_324,
+    status_410,
+    status_500
+};
+
+static constexpr event_t status_event_table[FSM_STATUS_COUNT] = {
+    NULL_event,  // NULL_status
+    received_heartbeat_event,  // status_100
+    received_heartbeat_event,  // status_110
+    received_heartbeat_event,  // status_111
+    file_send_tick_event,  // status_112
+    all_data_received_event,  // status_113
+    received_heartbeat_event,  // status_114
+    received_heartbeat_event,  // status_115
+    received_heartbeat_event,  // status_116
+    received_heartbeat_event,  // status_117
+    received_heartbeat_event,  // status_120
+    received_heartbeat_event,  // status_121
+    all_nodes_replied_event,  // status_122
+    received_heartbeat_event,  // status_124
+    received_heartbeat_event,  // status_125
+    all_nodes_replied_event,  // status_126
+    received_heartbeat_event,  // status_130
+    received_heartbeat_event,  // status_131
+    timing_offset_elapsed_event,  // status_132
+    received_heartbeat_event,  // status_134
+    received_heartbeat_event,  // status_135
+    timing_offset_elapsed_event,  // status_136
+    received_heartbeat_event,  // status_140
+    received_heartbeat_event,  // status_141
+    all_nodes_have_file_event,  // status_142
+    received_heartbeat_event,  // status_145
+    all_nodes_have_file_with_more_event,  // status_146
+    received_heartbeat_event,  // status_147
+    received_heartbeat_event,  // status_150
+    received_heartbeat_event,  // status_155
+    timing_offset_elapsed_event,  // status_156
+    received_heartbeat_event,  // status_160
+    received_heartbeat_event,  // status_161
+    all_nodes_replied_event,  // status_162
+    received_heartbeat_event,  // status_164
+    received_heartbeat_event,  // status_165
+    all_nodes_replied_event,  // status_166
+    received_heartbeat_event,  // status_170
+    received_heartbeat_event,  // status_171
+    all_nodes_have_file_event,  // status_172
+    all_metadata_received_event,  // status_173
+    received_heartbeat_event,  // status_174
+    received_heartbeat_event,  // status_175
+    all_nodes_have_all_metadata_changes_with_more_event,  // status_177
+    all_nodes_have_all_metadata_changes_with_more_event,  // status_178
+    received_file_data_event,  // status_200
+    received_fake_file_data_event,  // status_210
+    new_local_file_event,  // status_300
+    new_local_file_reported_twice_event,  // status_301
+    new_local_file_with_more_event,  // status_304
+    local_file_metadata_change_event,  // status_320
+    local_file_metadata_change_with_more_event,  // status_324
+    received_heartbeat_event,  // status_410
+    interrupt_event  // status_500
+};
+
+static constexpr transition_t transition_table[FSM_TRANSITION_COUNT] = {
+    { NULL_action, NULL_status, NULL_state },  // 0
+    { send_heartbeat_action, status_120, announcing_new_file_state },  // 1
+    { send_heartbeat_action, status_124, announcing_new_file_with_more_state },  // 2
+    { send_heartbeat_action, status_160, announcing_file_metadata_change_state },  // 3
+    { send_heartbeat_action, status_164, announcing_file_metadata_change_with_more_state },  // 4
+    { send_heartbeat_action, status_100, ready_state },  // 5
+    { send_heartbeat_action, status_121, acknowledging_new_file_state },  // 6
+    { send_heartbeat_action, status_125, acknowledging_new_file_with_more_state },  // 7
+    { send_heartbeat_action, status_161, acknowledging_file_metadata_change_state },  // 8
+    { send_heartbeat_action, status_165, acknowledging_file_metadata_change_with_more_state },  // 9
+    { exit_action, status_500, exit_state },  // 10
+    { send_heartbeat_action, status_130, sending_new_file_metadata_state },  // 11
+    { send_heartbeat_action, status_134, sending_new_file_metadata_with_more_state },  // 12
+    { send_heartbeat_action, status_170, sending_file_metadata_change_state },  // 13
+    { send_heartbeat_action, status_174, sending_file_metadata_change_with_more_state },  // 14
+    { add_new_file_to_queue_action, status_130, sending_new_file_metadata_state },  // 15
+    { send_heartbeat_action, status_110, sending_new_file_state },  // 16
+    { add_new_file_to_queue_action, status_134, sending_new_file_metadata_with_more_state },  // 17
+    { send_heartbeat_action, status_114, sending_new_file_with_more_alpha_state },  // 18
+    { add_new_file_to_queue_action, status_170, sending_file_metadata_change_state },  // 19
+    { send_heartbeat_action, status_150, ready_state },  // 20
+    { add_new_file_to_queue_action, status_110, sending_new_file_state },  // 21
+    { send_heartbeat_action, status_410, ready_state },  // 22
+    { send_heartbeat_action, status_155, syncing_stop_state },  // 23
+    { send_file_data_action, status_200, sending_new_file_state },  // 24
+    { ignore_action, status_110, sending_new_file_state },  // 25
+    { add_new_file_to_queue_action, status_114, sending_new_file_with_more_alpha_state },  // 26
+    { send_file_data_action, status_200, sending_new_file_with_more_alpha_state },  // 27
+    { ignore_action, status_114, sending_new_file_with_more_alpha_state },  // 28
+    { send_heartbeat_action, status_116, sending_new_file_with_more_beta_state },  // 29
+    { add_new_file_to_queue_action, status_116, sending_new_file_with_more_beta_state },  // 30
+    { send_file_data_action, status_200, sending_new_file_with_more_beta_state },  // 31
+    { ignore_action, status_116, sending_new_file_with_more_beta_state },  // 32
+    { add_new_file_to_queue_action, status_121, acknowledging_new_file_state },  // 33
+    { send_heartbeat_action, status_131, promoting_new_file_metadata_state },  // 34
+    { add_new_file_to_queue_action, status_125, acknowledging_new_file_with_more_state },  // 35
+    { send_heartbeat_action, status_131, promoting_new_file_metadata_with_more_state },  // 36
+    { add_new_file_to_queue_action, status_161, acknowledging_file_metadata_change_state },  // 37
+    { send_heartbeat_action, status_171, receiving_file_metadata_change_state },  // 38
+    { add_new_file_to_queue_action, status_165, acknowledging_file_metadata_change_with_more_state },  // 39
+    { send_heartbeat_action, status_175, receiving_file_metadata_change_with_more_state },  // 40
+    { add_new_file_to_queue_action, status_131, promoting_new_file_metadata_state },  // 41
+    { send_heartbeat_action, status_135, promoting_new_file_metadata_with_more_state },  // 42
+    { send_heartbeat_action, status_111, sending_fake_file_state },  // 43
+    { add_new_file_to_queue_action, status_135, promoting_new_file_metadata_with_more_state },  // 44
+    { send_heartbeat_action, status_115, sending_fake_file_with_more_alpha_state },  // 45
+    { add_new_file_to_queue_action, status_171, receiving_file_metadata_change_state },  // 46
+    { send_heartbeat_action, status_171, receiving_file_metadata_change_with_more_state },  // 47
+    { send_heartbeat_action, status_141, broadcasting_all_metadata_received_state },  // 48
+    { add_new_file_to_queue_action, status_175, receiving_file_metadata_change_with_more_state },  // 49
+    { add_new_file_to_queue_action, status_111, sending_fake_file_state },  // 50
+    { send_file_data_action, status_210, sending_fake_file_state },  // 51
+    { store_file_data_action, status_111, sending_fake_file_state },  // 52
+    { send_heartbeat_action, status_140, broadcasting_all_received_state },  // 53
+    { add_new_file_to_queue_action, status_115, sending_fake_file_with_more_alpha_state },  // 54
+    { send_file_data_action, status_210, sending_fake_file_with_more_alpha_state },  // 55
+    { store_file_data_action, status_115, sending_fake_file_with_more_alpha_state },  // 56
+    { send_heartbeat_action, status_145, broadcasting_all_received_with_more_alpha_state },  // 57
+    { add_new_file_to_queue_action, status_117, sending_fake_file_with_more_beta_state },  // 58
+    { send_heartbeat_action, status_117, sending_fake_file_with_more_beta_state },  // 59
+    { send_file_data_action, status_210, sending_fake_file_with_more_beta_state },  // 60
+    { store_file_data_action, status_117, sending_fake_file_with_more_beta_state },  // 61
+    { send_heartbeat_action, status_147, broadcasting_all_received_with_more_beta_state },  // 62
+    { add_new_file_to_queue_action, status_140, broadcasting_all_received_state },  // 63
+    { send_fake_file_data_action, status_210, broadcasting_all_received_state },  // 64
+    { add_new_file_to_queue_action, status_145, broadcasting_all_received_with_more_alpha_state },  // 65
+    { send_fake_file_data_action, status_210, broadcasting_all_received_with_more_alpha_state },  // 66
+    { add_new_file_to_queue_action, status_147, broadcasting_all_received_with_more_beta_state },  // 67
+    { send_fake_file_data_action, status_210, broadcasting_all_received_with_more_beta_state },  // 68
+    { add_new_file_to_queue_action, status_141, broadcasting_all_metadata_received_state },  // 69
+    { send_fake_file_data_action, status_210, syncing_stop_state }  // 70
+};
+
+//  transitions of a (state, event) row, indexed by status index
+static constexpr unsigned char
+  transition_row_table[FSM_TRANSITION_ROW_COUNT][FSM_STATUS_COUNT] = {
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 0
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0 },  // 1
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0 },  // 2
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0 },  // 3
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0 },  // 4
+    { 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 8, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 5
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10 },  // 6
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0 },  // 7
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0 },  // 8
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 9
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 10
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0 },  // 11
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 12
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 13
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0 },  // 14
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },  // 15
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 16
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 17
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 18
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 19
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0 },  // 20
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0 },  // 21
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0 },  // 22
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0 },  // 23
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 24
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 25
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0 },  // 26
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0 },  // 27
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0 },  // 28
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0 },  // 29
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 30
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 31
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0 },  // 32
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0 },  // 33
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0 },  // 34
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0 },  // 35
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 36
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 37
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0 },  // 38
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0 },  // 39
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0 },  // 40
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0 },  // 41
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 42
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 43
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0 },  // 44
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0 },  // 45
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0 },  // 46
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0 },  // 47
+    { 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 48
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 49
+    { 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 50
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0 },  // 51
+    { 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 52
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0 },  // 53
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0 },  // 54
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0 },  // 55
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0 },  // 56
+    { 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 57
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 58
+    { 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 59
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0 },  // 60
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 61
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0 },  // 62
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0 },  // 63
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0 },  // 64
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0 },  // 65
+    { 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 66
+    { 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 67
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },  // 68
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 69
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0 },  // 70
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0 },  // 71
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0 },  // 72
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0 },  // 73
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 7, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 74
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0 },  // 75
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0 },  // 76
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0 },  // 77
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0 },  // 78
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 79
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 37, 0, 0, 0 },  // 80
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0 },  // 81
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 9, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 82
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 39, 0, 0, 0 },  // 83
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 39, 0, 0 },  // 84
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 85
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 41, 0, 0, 0 },  // 86
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 41, 0, 0 },  // 87
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 88
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 89
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 44, 0, 0, 0 },  // 90
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 44, 0, 0 },  // 91
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 92
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 93
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 46, 0, 0, 0 },  // 94
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 46, 0, 0 },  // 95
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 96
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 97
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 49, 0, 0, 0 },  // 98
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 0, 0 },  // 99
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 100
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 50, 0, 0, 0 },  // 101
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 50, 0, 0 },  // 102
+    { 0, 0, 43, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 103
+    { 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 104
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0 },  // 105
+    { 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 106
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 54, 0, 0, 0 },  // 107
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 54, 0, 0 },  // 108
+    { 0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 109
+    { 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 110
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0 },  // 111
+    { 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 112
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 58, 0, 0, 0 },  // 113
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 58, 0, 0 },  // 114
+    { 0, 0, 0, 0, 0, 0, 59, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0 },  // 115
+    { 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 116
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 0 },  // 117
+    { 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 118
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 63, 0, 0, 0 },  // 119
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 63, 0, 0 },  // 120
+    { 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 121
+    { 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 122
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 65, 0, 0, 0 },  // 123
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 65, 0, 0 },  // 124
+    { 0, 0, 0, 0, 0, 0, 57, 57, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 125
+    { 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 126
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 67, 0, 0, 0 },  // 127
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 67, 0, 0 },  // 128
+    { 0, 0, 0, 0, 0, 0, 45, 0, 62, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 129
+    { 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 130
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 69, 0, 0, 0 },  // 131
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 69, 0, 0 },  // 132
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 42, 0, 0, 0, 48, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 133
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 134
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // 135
+    { 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }  // 136
+};
+
+static constexpr unsigned char
+  transition_row_index_table[FSM_STATE_COUNT][FSM_EVENT_COUNT] = {
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },  // NULL_state
+    { 0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // ready_state
+    { 0, 7, 2, 8, 4, 9, 10, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // announcing_new_file_state
+    { 0, 7, 2, 8, 4, 12, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // announcing_new_file_with_more_state
+    { 0, 14, 15, 8, 4, 16, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // announcing_file_metadata_change_state
+    { 0, 14, 15, 8, 4, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // announcing_file_metadata_change_with_more_state
+    { 0, 20, 21, 22, 23, 24, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // sending_new_file_metadata_state
+    { 0, 26, 27, 28, 29, 30, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // sending_new_file_metadata_with_more_state
+    { 0, 32, 33, 34, 35, 36, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // sending_file_metadata_change_state
+    { 0, 38, 39, 40, 41, 42, 0, 0, 0, 0, 37, 43, 0, 0, 0, 0, 0, 0, 0, 6 },  // sending_file_metadata_change_with_more_state
+    { 0, 44, 45, 46, 47, 48, 0, 0, 0, 49, 0, 0, 50, 51, 52, 0, 0, 0, 0, 6 },  // sending_new_file_state
+    { 0, 53, 54, 55, 56, 57, 0, 0, 0, 58, 0, 0, 59, 60, 52, 61, 0, 0, 0, 6 },  // sending_new_file_with_more_alpha_state
+    { 0, 62, 63, 64, 65, 66, 0, 0, 0, 58, 0, 0, 67, 68, 52, 69, 0, 0, 0, 6 },  // sending_new_file_with_more_beta_state
+    { 0, 70, 71, 72, 73, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // acknowledging_new_file_state
+    { 0, 75, 76, 77, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // acknowledging_new_file_with_more_state
+    { 0, 80, 81, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // acknowledging_file_metadata_change_state
+    { 0, 83, 84, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // acknowledging_file_metadata_change_with_more_state
+    { 0, 86, 87, 0, 0, 88, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // promoting_new_file_metadata_state
+    { 0, 90, 91, 0, 0, 92, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 },  // promoting_new_file_metadata_with_more_state
+    { 0, 94, 95, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 6 },  // receiving_file_metadata_change_state
+    { 0, 98, 99, 0, 0, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 6 },  // receiving_file_metadata_change_with_more_state
+    { 0, 101, 102, 0, 0, 103, 0, 0, 0, 0, 0, 0, 104, 0, 52, 0, 0, 105, 106, 6 },  // sending_fake_file_state
+    { 0, 107, 108, 0, 0, 109, 0, 0, 0, 0, 0, 0, 110, 0, 52, 0, 0, 111, 112, 6 },  // sending_fake_file_with_more_alpha_state
+    { 0, 113, 114, 0, 0, 115, 0, 0, 0, 0, 0, 0, 116, 0, 52, 0, 0, 117, 118, 6 },  // sending_fake_file_with_more_beta_state
+    { 0, 119, 120, 0, 0, 121, 0, 0, 0, 0, 0, 0, 122, 0, 52, 0, 0, 0, 0, 6 },  // broadcasting_all_received_state
+    { 0, 123, 124, 0, 0, 125, 0, 0, 0, 0, 0, 0, 126, 0, 52, 0, 0, 0, 0, 6 },  // broadcasting_all_received_with_more_alpha_state
+    { 0, 127, 128, 0, 0, 129, 0, 0, 0, 0, 0, 0, 130, 0, 52, 0, 0, 0, 0, 6 },  // broadcasting_all_received_with_more_beta_state
+    { 0, 131, 132, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 6 },  // broadcasting_all_metadata_received_state
+    { 0, 0, 0, 0, 0, 134, 0, 0, 135, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 6 },  // syncing_stop_state
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6 }  // exit_state
+};
+
 //  ---------------------------------------------------------------------------
 //  State machine API
 
-static inline event_t
+static constexpr unsigned char
+  get_status_index(status_t status) {
+    return (unsigned int)status < FSM_STATUS_CODE_LIMIT
+         ? status_index_table[status] : 0;
+}
+
+static constexpr const transition_t&
+  get_transition(state_t state, event_t event, status_t status) {
+    return transition_table[transition_row_table[
+        (unsigned int)state < FSM_STATE_COUNT && (unsigned int)event < FSM_EVENT_COUNT
+          ? transition_row_index_table[state][event] : 0
+      ][get_status_index(status)]];
+}
+
+static constexpr event_t
   get_event_by_status_code(status_t status) {
-    if ( status == status_100 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_110 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_111 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_112 ) {
-        return file_send_tick_event;
-    } else if ( status == status_113 ) {
-        return all_data_received_event;
-    } else if ( status == status_114 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_115 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_116 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_117 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_120 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_121 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_122 ) {
-        return all_nodes_replied_event;
-    } else if ( status == status_124 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_125 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_126 ) {
-        return all_nodes_replied_event;
-    } else if ( status == status_130 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_131 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_132 ) {
-        return timing_offset_elapsed_event;
-    } else if ( status == status_134 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_135 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_136 ) {
-        return timing_offset_elapsed_event;
-    } else if ( status == status_140 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_141 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_142 ) {
-        return all_nodes_have_file_event;
-    } else if ( status == status_145 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_146 ) {
-        return all_nodes_have_file_with_more_event;
-    } else if ( status == status_147 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_150 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_155 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_156 ) {
-        return timing_offset_elapsed_event;
-    } else if ( status == status_160 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_161 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_162 ) {
-        return all_nodes_replied_event;
-    } else if ( status == status_164 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_165 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_166 ) {
-        return all_nodes_replied_event;
-    } else if ( status == status_170 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_171 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_172 ) {
-        return all_nodes_have_file_event;
-    } else if ( status == status_173 ) {
-        return all_metadata_received_event;
-    } else if ( status == status_174 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_175 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_177 ) {
-        return all_nodes_have_all_metadata_changes_with_more_event;
-    } else if ( status == status_178 ) {
-        return all_nodes_have_all_metadata_changes_with_more_event;
-    } else if ( status == status_200 ) {
-        return received_file_data_event;
-    } else if ( status == status_210 ) {
-        return received_fake_file_data_event;
-    } else if ( status == status_300 ) {
-        return new_local_file_event;
-    } else if ( status == status_301 ) {
-        return new_local_file_reported_twice_event;
-    } else if ( status == status_304 ) {
-        return new_local_file_with_more_event;
-    } else if ( status == status_320 ) {
-        return local_file_metadata_change_event;
-    } else if ( status == status_324 ) {
-        return local_file_metadata_change_with_more_event;
-    } else if ( status == status_410 ) {
-        return received_heartbeat_event;
-    } else if ( status == status_500 ) {
-        return interrupt_event;
-    } else {
-        return NULL_event;
-    }
+    return status_event_table[get_status_index(status)];
 }
 
-static inline bool
+static constexpr bool
   check_event(state_t state, event_t event, status_t status) {
-    if ( state == ready_state ) {
-        if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_100 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_120 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_160 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == announcing_new_file_state ) {
-        if ( event == received_heartbeat_event && status == status_121 ) {
-            return true;
-        } else if ( event == all_nodes_replied_event && status == status_122 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_reported_twice_event && status == status_301 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == announcing_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_125 ) {
-            return true;
-        } else if ( event == all_nodes_replied_event && status == status_126 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == announcing_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_161 ) {
-            return true;
-        } else if ( event == all_nodes_replied_event && status == status_162 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == announcing_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_165 ) {
-            return true;
-        } else if ( event == all_nodes_replied_event && status == status_166 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && status == status_131 ) {
-            return true;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_135 ) {
-            return true;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_171 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_event && status == status_172 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_175 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return true;
-        } else if ( event == all_nodes_have_all_files_event && status == status_172 ) {
-            return true;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && status == status_177 ) {
-            return true;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && status == status_178 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_new_file_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return true;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_new_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return true;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_with_more_event && status == status_146 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_new_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return true;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return true;
-        } else if ( event == all_nodes_have_file_with_more_event && status == status_146 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == acknowledging_new_file_state ) {
-        if ( event == received_heartbeat_event && status == status_130 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_120 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_121 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == acknowledging_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_134 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_125 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return true;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == acknowledging_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_160 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_161 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == acknowledging_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_174 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_165 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == promoting_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && status == status_130 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_131 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_134 ) {
-            return true;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == promoting_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_134 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_135 ) {
-            return true;
-        } else if ( event == timing_offset_elapsed_event && status == status_136 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == receiving_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_171 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_175 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return true;
-        } else if ( event == all_metadata_received_event && status == status_173 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == receiving_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_174 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_175 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return true;
-        } else if ( event == all_metadata_received_event && status == status_173 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_fake_file_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_110 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return true;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return true;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_fake_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return true;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return true;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == sending_fake_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_117 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return true;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return true;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == broadcasting_all_received_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_110 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_155 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == broadcasting_all_received_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_116 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == broadcasting_all_received_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_116 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_117 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_147 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == broadcasting_all_metadata_received_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_171 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_130 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_134 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return true;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return true;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return true;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == syncing_stop_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return true;
-        } else if ( event == received_heartbeat_event && status == status_155 ) {
-            return true;
-        } else if ( event == timing_offset_elapsed_event && status == status_156 ) {
-            return true;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else if ( state == exit_state ) {
-        if ( event == interrupt_event && status == status_500 ) {
-            return true;
-        } else {
-            return false;
-        }
-    } else {
-        return false;
-    }
+    return get_transition(state, event, status).new_state != NULL_state;
 }
 
-static inline action_t
+static constexpr action_t
   get_action(state_t state, event_t event, status_t status) {
-    if ( state == ready_state ) {
-        if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_120 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_160 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == announcing_new_file_state ) {
-        if ( event == received_heartbeat_event && status == status_121 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_replied_event && status == status_122 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_reported_twice_event && status == status_301 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == announcing_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_125 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_replied_event && status == status_126 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == announcing_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_161 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_replied_event && status == status_162 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == announcing_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_165 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_replied_event && status == status_166 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && status == status_131 ) {
-            return send_heartbeat_action;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_135 ) {
-            return send_heartbeat_action;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_171 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_file_event && status == status_172 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_175 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_all_files_event && status == status_172 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && status == status_177 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && status == status_178 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return send_heartbeat_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_new_file_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return ignore_action;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_new_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return ignore_action;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_file_with_more_event && status == status_146 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_new_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_fake_file_data_event && status == status_210 ) {
-            return ignore_action;
-        } else if ( event == all_nodes_have_file_event && status == status_142 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_nodes_have_file_with_more_event && status == status_146 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == acknowledging_new_file_state ) {
-        if ( event == received_heartbeat_event && status == status_130 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_120 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_121 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == acknowledging_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_134 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_124 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_125 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == local_file_metadata_change_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == acknowledging_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_160 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_161 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == acknowledging_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_174 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_164 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_165 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == promoting_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && status == status_130 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_131 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_134 ) {
-            return send_heartbeat_action;
-        } else if ( event == timing_offset_elapsed_event && status == status_132 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == promoting_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_134 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_135 ) {
-            return send_heartbeat_action;
-        } else if ( event == timing_offset_elapsed_event && status == status_136 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == receiving_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_171 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_175 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_metadata_received_event && status == status_173 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == receiving_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && status == status_174 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_175 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return send_heartbeat_action;
-        } else if ( event == all_metadata_received_event && status == status_173 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_fake_file_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_110 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return store_file_data_action;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_fake_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return store_file_data_action;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == sending_fake_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_117 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_file_data_event && status == status_200 ) {
-            return store_file_data_action;
-        } else if ( event == all_data_received_event && status == status_113 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == received_heartbeat_event && status == status_410 ) {
-            return send_heartbeat_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == broadcasting_all_received_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_fake_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_110 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_111 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_140 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_155 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == broadcasting_all_received_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_fake_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_115 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_145 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_116 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == broadcasting_all_received_with_more_beta_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_fake_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_116 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_117 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_147 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_114 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == broadcasting_all_metadata_received_state ) {
-        if ( event == received_heartbeat_event && status == status_170 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_171 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_141 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_130 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_134 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return send_heartbeat_action;
-        } else if ( event == new_local_file_event && status == status_300 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_304 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_event && status == status_320 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == new_local_file_with_more_event && status == status_324 ) {
-            return add_new_file_to_queue_action;
-        } else if ( event == node_only_sends_heartbeats_event && status == status_100 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == syncing_stop_state ) {
-        if ( event == file_send_tick_event && status == status_112 ) {
-            return send_fake_file_data_action;
-        } else if ( event == received_heartbeat_event && status == status_150 ) {
-            return send_heartbeat_action;
-        } else if ( event == received_heartbeat_event && status == status_155 ) {
-            return send_heartbeat_action;
-        } else if ( event == timing_offset_elapsed_event && status == status_156 ) {
-            return send_heartbeat_action;
-        } else if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else if ( state == exit_state ) {
-        if ( event == interrupt_event && status == status_500 ) {
-            return exit_action;
-        } else {
-            return NULL_action;
-        }
-    } else {
-        return NULL_action;
-    }
+    return get_transition(state, event, status).action;
 }
 
-static inline status_t
+static constexpr status_t
   get_heartbeat_status(state_t state, event_t event, status_t received_status) {
-    if ( state == ready_state ) {
-        if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_120;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_124;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_160;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_164;
-        } else if ( event == received_heartbeat_event && received_status == status_100 ) {
-            return status_100;
-        } else if ( event == received_heartbeat_event && received_status == status_120 ) {
-            return status_121;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return status_125;
-        } else if ( event == received_heartbeat_event && received_status == status_160 ) {
-            return status_161;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return status_165;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return status_100;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == announcing_new_file_state ) {
-        if ( event == received_heartbeat_event && received_status == status_121 ) {
-            return status_120;
-        } else if ( event == all_nodes_replied_event && received_status == status_122 ) {
-            return status_130;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_124;
-        } else if ( event == new_local_file_reported_twice_event && received_status == status_301 ) {
-            return status_120;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_124;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_164;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == announcing_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_125 ) {
-            return status_124;
-        } else if ( event == all_nodes_replied_event && received_status == status_126 ) {
-            return status_134;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_124;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_124;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_164;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == announcing_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_161 ) {
-            return status_160;
-        } else if ( event == all_nodes_replied_event && received_status == status_162 ) {
-            return status_170;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_164;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_164;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == announcing_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_165 ) {
-            return status_164;
-        } else if ( event == all_nodes_replied_event && received_status == status_166 ) {
-            return status_174;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_164;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_164;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_164;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && received_status == status_131 ) {
-            return status_130;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return status_110;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_130;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_130;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_130;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_130;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_135 ) {
-            return status_134;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return status_114;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_134;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_134;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_134;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_134;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return status_170;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return status_170;
-        } else if ( event == all_nodes_have_file_event && received_status == status_172 ) {
-            return status_150;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_170;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_170;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_170;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_170;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return status_174;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return status_174;
-        } else if ( event == all_nodes_have_all_files_event && received_status == status_172 ) {
-            return status_150;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && received_status == status_177 ) {
-            return status_130;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && received_status == status_178 ) {
-            return status_134;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_174;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_174;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_174;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_174;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_new_file_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_200;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return status_110;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return status_110;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return status_110;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return status_155;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_110;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_110;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_110;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_110;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_new_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_200;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return status_114;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return status_114;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return status_114;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return status_110;
-        } else if ( event == all_nodes_have_file_with_more_event && received_status == status_146 ) {
-            return status_116;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_114;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_114;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_114;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_114;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_new_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_200;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return status_116;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return status_116;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return status_116;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return status_110;
-        } else if ( event == all_nodes_have_file_with_more_event && received_status == status_146 ) {
-            return status_114;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_116;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_116;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_116;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_116;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == acknowledging_new_file_state ) {
-        if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return status_131;
-        } else if ( event == received_heartbeat_event && received_status == status_120 ) {
-            return status_121;
-        } else if ( event == received_heartbeat_event && received_status == status_121 ) {
-            return status_121;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return status_125;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_121;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_121;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_121;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_121;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == acknowledging_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return status_131;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return status_125;
-        } else if ( event == received_heartbeat_event && received_status == status_125 ) {
-            return status_125;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_125;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_125;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return status_125;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return status_125;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == acknowledging_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return status_171;
-        } else if ( event == received_heartbeat_event && received_status == status_160 ) {
-            return status_161;
-        } else if ( event == received_heartbeat_event && received_status == status_161 ) {
-            return status_161;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return status_165;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_161;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_161;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_161;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_161;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == acknowledging_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_174 ) {
-            return status_175;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return status_165;
-        } else if ( event == received_heartbeat_event && received_status == status_165 ) {
-            return status_165;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_165;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_165;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_165;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_165;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == promoting_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return status_131;
-        } else if ( event == received_heartbeat_event && received_status == status_131 ) {
-            return status_131;
-        } else if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return status_135;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return status_111;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_131;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_131;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_131;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_131;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == promoting_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return status_135;
-        } else if ( event == received_heartbeat_event && received_status == status_135 ) {
-            return status_135;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_136 ) {
-            return status_115;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_135;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_135;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_135;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_135;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == receiving_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return status_171;
-        } else if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return status_171;
-        } else if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return status_171;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return status_171;
-        } else if ( event == all_metadata_received_event && received_status == status_173 ) {
-            return status_141;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_171;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_171;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_171;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_171;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == receiving_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_174 ) {
-            return status_175;
-        } else if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return status_175;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return status_175;
-        } else if ( event == all_metadata_received_event && received_status == status_173 ) {
-            return status_141;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_175;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_175;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_175;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_175;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_fake_file_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_110 ) {
-            return status_111;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return status_111;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return status_111;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return status_111;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return status_140;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_111;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_111;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_111;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_111;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_fake_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return status_115;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return status_115;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return status_115;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return status_115;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return status_145;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_115;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_115;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_115;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_115;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == sending_fake_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return status_117;
-        } else if ( event == received_heartbeat_event && received_status == status_117 ) {
-            return status_117;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return status_117;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return status_117;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return status_147;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_117;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_117;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_117;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_117;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return status_410;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == broadcasting_all_received_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_110 ) {
-            return status_140;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return status_140;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return status_140;
-        } else if ( event == received_heartbeat_event && received_status == status_155 ) {
-            return status_155;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_140;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_140;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_140;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_140;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == broadcasting_all_received_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return status_145;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return status_145;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return status_145;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return status_111;
-        } else if ( event == received_heartbeat_event && received_status == status_116 ) {
-            return status_117;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_145;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_145;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_145;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_145;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == broadcasting_all_received_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_116 ) {
-            return status_147;
-        } else if ( event == received_heartbeat_event && received_status == status_117 ) {
-            return status_147;
-        } else if ( event == received_heartbeat_event && received_status == status_147 ) {
-            return status_147;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return status_111;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return status_115;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_147;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_147;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_147;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_147;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == broadcasting_all_metadata_received_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return status_141;
-        } else if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return status_141;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return status_141;
-        } else if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return status_131;
-        } else if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return status_135;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return status_150;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return status_141;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return status_141;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return status_141;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return status_141;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return status_410;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == syncing_stop_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return status_210;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return status_155;
-        } else if ( event == received_heartbeat_event && received_status == status_155 ) {
-            return status_155;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_156 ) {
-            return status_100;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else if ( state == exit_state ) {
-        if ( event == interrupt_event && received_status == status_500 ) {
-            return status_500;
-        } else {
-            return NULL_status;
-        }
-    } else {
-        return NULL_status;
-    }
+    return get_transition(state, event, received_status).heartbeat_status;
 }
 
-static inline state_t
+static constexpr state_t
   get_new_state(state_t state, event_t event, status_t received_status) {
-    if ( state == ready_state ) {
-        if ( event == new_local_file_event && received_status == status_300 ) {
-            return announcing_new_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return announcing_file_metadata_change_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == received_heartbeat_event && received_status == status_120 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_160 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == announcing_new_file_state ) {
-        if ( event == received_heartbeat_event && received_status == status_121 ) {
-            return announcing_new_file_state;
-        } else if ( event == all_nodes_replied_event && received_status == status_122 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == new_local_file_reported_twice_event && received_status == status_301 ) {
-            return announcing_new_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == announcing_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_125 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == all_nodes_replied_event && received_status == status_126 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return announcing_new_file_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == announcing_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_161 ) {
-            return announcing_file_metadata_change_state;
-        } else if ( event == all_nodes_replied_event && received_status == status_162 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == announcing_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_165 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == all_nodes_replied_event && received_status == status_166 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return announcing_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && received_status == status_131 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return sending_new_file_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_135 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == all_nodes_have_file_event && received_status == status_172 ) {
-            return ready_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_file_metadata_change_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == all_nodes_have_all_files_event && received_status == status_172 ) {
-            return ready_state;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && received_status == status_177 ) {
-            return sending_new_file_metadata_state;
-        } else if ( event == all_nodes_have_all_metadata_changes_with_more_event && received_status == status_178 ) {
-            return sending_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_new_file_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return sending_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return sending_new_file_state;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return sending_new_file_state;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return syncing_stop_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_new_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_new_file_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_new_file_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_new_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return sending_new_file_state;
-        } else if ( event == all_nodes_have_file_with_more_event && received_status == status_146 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_new_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == received_fake_file_data_event && received_status == status_210 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == all_nodes_have_file_event && received_status == status_142 ) {
-            return sending_new_file_state;
-        } else if ( event == all_nodes_have_file_with_more_event && received_status == status_146 ) {
-            return sending_new_file_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return sending_new_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == acknowledging_new_file_state ) {
-        if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == received_heartbeat_event && received_status == status_120 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_121 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return acknowledging_new_file_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == acknowledging_new_file_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_124 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_125 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == local_file_metadata_change_event && received_status == status_320 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == local_file_metadata_change_with_more_event && received_status == status_324 ) {
-            return acknowledging_new_file_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == acknowledging_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_160 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_161 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return acknowledging_file_metadata_change_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == acknowledging_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_174 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_164 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_165 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return acknowledging_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == promoting_new_file_metadata_state ) {
-        if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == received_heartbeat_event && received_status == status_131 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_132 ) {
-            return sending_fake_file_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == promoting_new_file_metadata_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_135 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_136 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == receiving_file_metadata_change_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == all_metadata_received_event && received_status == status_173 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return receiving_file_metadata_change_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == receiving_file_metadata_change_with_more_state ) {
-        if ( event == received_heartbeat_event && received_status == status_174 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_175 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == all_metadata_received_event && received_status == status_173 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return receiving_file_metadata_change_with_more_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_fake_file_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_110 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return sending_fake_file_state;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_fake_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_fake_file_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return sending_fake_file_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_fake_file_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == sending_fake_file_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_117 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == received_file_data_event && received_status == status_200 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == all_data_received_event && received_status == status_113 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_410 ) {
-            return ready_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == broadcasting_all_received_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_110 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_111 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_140 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_155 ) {
-            return syncing_stop_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return broadcasting_all_received_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == broadcasting_all_received_with_more_alpha_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_115 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_145 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_116 ) {
-            return sending_fake_file_with_more_beta_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return broadcasting_all_received_with_more_alpha_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == broadcasting_all_received_with_more_beta_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_116 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_117 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_147 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return sending_fake_file_state;
-        } else if ( event == received_heartbeat_event && received_status == status_114 ) {
-            return sending_fake_file_with_more_alpha_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return broadcasting_all_received_with_more_beta_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == broadcasting_all_metadata_received_state ) {
-        if ( event == received_heartbeat_event && received_status == status_170 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_171 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_141 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == received_heartbeat_event && received_status == status_130 ) {
-            return promoting_new_file_metadata_state;
-        } else if ( event == received_heartbeat_event && received_status == status_134 ) {
-            return promoting_new_file_metadata_with_more_state;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return ready_state;
-        } else if ( event == new_local_file_event && received_status == status_300 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_304 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == new_local_file_event && received_status == status_320 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == new_local_file_with_more_event && received_status == status_324 ) {
-            return broadcasting_all_metadata_received_state;
-        } else if ( event == node_only_sends_heartbeats_event && received_status == status_100 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == syncing_stop_state ) {
-        if ( event == file_send_tick_event && received_status == status_112 ) {
-            return syncing_stop_state;
-        } else if ( event == received_heartbeat_event && received_status == status_150 ) {
-            return syncing_stop_state;
-        } else if ( event == received_heartbeat_event && received_status == status_155 ) {
-            return syncing_stop_state;
-        } else if ( event == timing_offset_elapsed_event && received_status == status_156 ) {
-            return ready_state;
-        } else if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else if ( state == exit_state ) {
-        if ( event == interrupt_event && received_status == status_500 ) {
-            return exit_state;
-        } else {
-            return NULL_state;
-        }
-    } else {
-        return NULL_state;
-    }
+    return get_transition(state, event, received_status).new_state;
 }
 
 #ifdef __cplusplus
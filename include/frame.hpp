@@ -0,0 +1,182 @@
+/**
+ * \file      frame.hpp
+ * \brief     Binary frames of all messages between and within nodes. 
+ *
+ *  Every message starts with a fixed little-endian header carrying its 
+ *  type, status, the box and node it concerns and the timestamp, 
+ *  offset and length fields most messages need. The payload follows 
+ *  the header; anything behind the payload is padding. Frames are 
+ *  parsed in place through a FrameView, so reading a message neither 
+ *  allocates nor copies its payload. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_FRAME_HPP_
+#define INCLUDE_FRAME_HPP_
+
+#include <string>
+#include <istream>
+#include <streambuf>
+#include <cstdint>
+#include <cstddef>
+
+#include "hash.hpp"
+#include "buffer_pool.hpp"
+
+#define F_FRAME_MAGIC 0xF1
+#define F_FRAME_VERSION 1
+
+// header fields and their offsets
+#define F_FRAME_MAGIC_POS 0
+#define F_FRAME_VERSION_POS 1
+#define F_FRAME_TYPE_POS 2
+#define F_FRAME_FLAGS_POS 3
+#define F_FRAME_STATUS_POS 4
+#define F_FRAME_PAYLOAD_LENGTH_POS 8
+#define F_FRAME_OP_POS 12
+// the lane of a box a transfer runs in, see Boxoffice::pickSession
+#define F_FRAME_LANE_POS 13
+#define F_FRAME_TIMESTAMP_POS 16
+#define F_FRAME_OFFSET_POS 24
+#define F_FRAME_LENGTH_POS 32
+#define F_FRAME_BOX_POS 40
+#define F_FRAME_NODE_POS (F_FRAME_BOX_POS + F_GENERIC_HASH_LEN)
+#define F_FRAME_HEADER_LEN (F_FRAME_NODE_POS + F_GENERIC_HASH_LEN)
+
+// flags
+#define F_FRAME_MORE 0x01
+
+/**
+ * \brief Read-only view of a received frame. 
+ *
+ *  The view points into the buffer it was created from, e.g. the data 
+ *  of a zmqpp::message, which has to outlive it. 
+ */
+class FrameView {
+ public:
+    FrameView() : data_(nullptr), size_(0) {}
+    FrameView(const void* data, const size_t size);
+
+    bool valid() const { return data_ != nullptr; }
+
+    uint8_t type() const;
+    int32_t status() const;
+    bool more() const;
+    uint8_t op() const;
+    uint8_t lane() const;
+    uint64_t timestamp() const;
+    uint64_t offset() const;
+    uint64_t length() const;
+    const unsigned char* box() const;
+    const unsigned char* node() const;
+    const char* payload() const;
+    size_t payloadSize() const;
+
+ private:
+    const unsigned char* data_;
+    size_t               size_;
+};
+
+/**
+ * \brief Builds a frame. 
+ *
+ *  Header fields can be set in any order, the payload is appended. The 
+ *  frame is built in a buffer of the thread's BufferPool; a frame may 
+ *  be moved but not copied, and gives its buffer back when destroyed 
+ *  unless it was handed over with release(). 
+ */
+class Frame {
+ public:
+    // without a buffer, e.g. a slot to move frames into
+    Frame() : pool_(nullptr), buffer_(nullptr), size_(0), payload_end_(0) {}
+    Frame(const uint8_t type, const int32_t status);
+    // copies header and payload of a received frame, but not its padding
+    explicit Frame(const FrameView& frame);
+    Frame(Frame&& other);
+    Frame& operator=(Frame&& other);
+    ~Frame();
+
+    Frame(const Frame&) = delete;
+    Frame& operator=(const Frame&) = delete;
+
+    Frame& setMore(const bool more);
+    Frame& setOp(const uint8_t op);
+    Frame& setLane(const uint8_t lane);
+    Frame& setTimestamp(const uint64_t timestamp);
+    Frame& setOffset(const uint64_t offset);
+    Frame& setLength(const uint64_t length);
+    Frame& setBox(const unsigned char box[F_GENERIC_HASH_LEN]);
+    Frame& setNode(const unsigned char node[F_GENERIC_HASH_LEN]);
+
+    Frame& putU8(const uint8_t value);
+    Frame& putU32(const uint32_t value);
+    Frame& putU64(const uint64_t value);
+    Frame& putBytes(const void* data, const size_t length);
+    Frame& putString(const std::string& s);
+    void pad(const size_t size);
+
+    const char* data() const { return buffer_; }
+    size_t size() const { return size_; }
+    BufferPool* pool() const { return pool_; }
+    // hands the buffer over, e.g. to zmq; it has to go back to pool()
+    char* release();
+
+ private:
+    BufferPool* pool_;
+    char*       buffer_;
+    size_t      size_;
+    size_t      payload_end_;
+};
+
+/**
+ * \brief Reads the fields of a payload in order. 
+ *
+ *  Every read fails once the payload is exhausted; ok() tells whether 
+ *  all reads so far succeeded. 
+ */
+class PayloadReader {
+ public:
+    explicit PayloadReader(const FrameView& frame);
+    PayloadReader(const char* data, const size_t size);
+
+    uint8_t getU8();
+    uint32_t getU32();
+    uint64_t getU64();
+    const char* getBytes(const size_t length);
+    const char* getString(size_t& length);
+
+    const char* rest() const { return data_ + pos_; }
+    size_t remaining() const { return size_ - pos_; }
+    bool ok() const { return ok_; }
+
+ private:
+    const char* data_;
+    size_t      size_;
+    size_t      pos_;
+    bool        ok_;
+};
+
+/**
+ * \brief istream over a memory range, e.g. a File record in a payload, 
+ *  without copying it. 
+ */
+class MemoryInputStream : public std::istream {
+ public:
+    MemoryInputStream(const char* data, const size_t size);
+
+ private:
+    class buffer_t : public std::streambuf {
+     public:
+        buffer_t(const char* data, const size_t size);
+     protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                         std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+    buffer_t buffer_;
+};
+
+#endif  // INCLUDE_FRAME_HPP_
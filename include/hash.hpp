@@ -48,8 +48,8 @@ class Hash {
         bool empty() const;
 
  private:
-  unsigned char* hash_;
-  bool           empty_;
+  unsigned char hash_[F_GENERIC_HASH_LEN];
+  bool          empty_;
 
   friend bool operator<  (const Hash&, const Hash&);
   friend bool operator>  (const Hash&, const Hash&);
@@ -1,16 +1,25 @@
 /**
- * Each publisher has its own heartbeater thread that calls upon the 
- * publisher to send out heartbeats at semi-regular intervals. Each 
- * heartbeater shall be initialized and managed by the boxoffice. 
- * For each heartbeater there shall be a separate heartbeater thread. 
+ * The heartbeater thread calls upon the publishers to send out 
+ * heartbeats at semi-regular intervals. There is exactly one, 
+ * initialized and managed by the boxoffice; it hands every heartbeat 
+ * to the publishers of all hosts. 
+ *
+ * A heartbeat goes out on every tick, F_HEARTBEAT_TICKS times per 
+ * heartbeat interval, whether anything changed or not, and every one 
+ * is F_HEARTBEAT_LEN long. So the traffic of all nodes looks the same 
+ * as long as they share the interval, and a change of status waits for 
+ * one tick instead of a whole interval. 
  */
 
 #ifndef F_HEARTBEATER_HPP
 #define F_HEARTBEATER_HPP
 
 #include <zmqpp/zmqpp.hpp>
+#include <map>
+#include <vector>
 
 #include "transmitter.hpp"
+#include "id_registry.hpp"
 
 namespace fsm {
   #include "flock_fsm.h"
@@ -21,10 +30,16 @@ class Heartbeater : public Transmitter
   public:
     Heartbeater() :
       Transmitter(),
-      z_heartbeater(nullptr),
-      z_boxoffice_hb_push(nullptr),
-      current_status_(fsm::status_100),
-      current_message_("")
+      pub_hb_channels(),
+      bo_hb_channel(nullptr),
+      interval_(F_HEARTBEAT_INTERVAL_DEFAULT),
+      idle_status_(fsm::status_100),
+      box_ids_(),
+      sessions_(),
+      changed_(),
+      last_session_(0),
+      delays_(),
+      last_peer_(0)
       {};
     Heartbeater(zmqpp::context* z_ctx_, fsm::status_t status);
     Heartbeater(const Heartbeater&);
@@ -36,10 +51,37 @@ class Heartbeater : public Transmitter
     int connectToPublisher();
     int connectToBoxofficeHB();
 
-    zmqpp::socket* z_heartbeater;
-    zmqpp::socket* z_boxoffice_hb_push;
-    fsm::status_t current_status_;
-    std::string   current_message_;
+    // to the publisher of every host
+    std::vector<FrameChannel*> pub_hb_channels;
+    FrameChannel* bo_hb_channel;
+    // the latest status of a session and its payload, kept in place so 
+    // taking turns neither allocates nor copies
+    struct heartbeat_t {
+      fsm::status_t status;
+      // not idle, or going idle and not announced as such yet
+      bool          busy;
+      // in changed_
+      bool          changed;
+      size_t        length;
+      char          message[F_HEARTBEAT_PAYLOAD_LEN];
+    };
+
+    void resizeSessions(const size_t boxes);
+
+    uint32_t      interval_;
+    // sent while no box has anything going on
+    fsm::status_t idle_status_;
+    // every session by the index of its box in box_ids_ times 
+    // F_PIPELINE_LANES plus its lane, and the sessions whose change is 
+    // not sent yet, in order
+    IdRegistry    box_ids_;
+    std::vector<heartbeat_t> sessions_;
+    std::vector<size_t> changed_;
+    size_t        last_session_;
+    // the delay of the heartbeats of every node to us, by s_node_id, as 
+    // measured by the boxoffice
+    std::map<uint64_t, uint64_t> delays_;
+    uint64_t      last_peer_;
 };
 
 #endif
\ No newline at end of file
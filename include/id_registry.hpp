@@ -0,0 +1,51 @@
+/**
+ * \file      id_registry.hpp
+ * \brief     Dense indices for the box and node IDs of this flock.
+ *
+ *  Boxes and nodes are named by hashes of F_GENERIC_HASH_LEN bytes on
+ *  the wire. Internally they are interned once to small indices from 0,
+ *  so their boxes, sessions and node_t can be kept in flat arrays. The
+ *  indices are local to a node and never sent.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_ID_REGISTRY_HPP_
+#define INCLUDE_ID_REGISTRY_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "hash.hpp"
+
+/**
+ * \brief Open addressing table from IDs to their indices.
+ *
+ *  The IDs are stored back to back in one buffer and the table only
+ *  holds indices into it, so a lookup neither allocates nor chases
+ *  pointers. The table is kept at most half full.
+ */
+class IdRegistry {
+ public:
+    IdRegistry();
+
+    // the index of the ID, which is added if it is new
+    uint32_t intern(const unsigned char id[F_GENERIC_HASH_LEN]);
+    // the index of the ID or -1 if it is unknown
+    int find(const unsigned char id[F_GENERIC_HASH_LEN]) const;
+    // valid until the next ID is added
+    const unsigned char* get(const uint32_t index) const;
+    uint32_t size() const;
+
+ private:
+    size_t slot(const unsigned char id[F_GENERIC_HASH_LEN]) const;
+    void grow();
+
+    std::vector<unsigned char> ids_;
+    // index + 1 of the ID in the slot, 0 for an empty one
+    std::vector<uint32_t>      slots_;
+    uint32_t                   count_;
+};
+
+#endif  // INCLUDE_ID_REGISTRY_HPP_
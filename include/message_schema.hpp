@@ -0,0 +1,419 @@
+/**
+ * \file      message_schema.hpp
+ * \brief     Payload layouts of the frames, keyed by Flock FSM status code.
+ *
+ *  Every payload with fixed fields has them at constant offsets. Encoding
+ *  writes those fields into a stack buffer of the fixed size and appends
+ *  it in one go, decoding checks the payload size once and then loads
+ *  every field from its offset. The variable part of a payload, e.g. a
+ *  File record, follows the fixed fields and is only pointed to.
+ *
+ *  heartbeat_schema maps the status codes of heartbeats to their payload,
+ *  so decoding a heartbeat with the payload of another status does not
+ *  compile.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_MESSAGE_SCHEMA_HPP_
+#define INCLUDE_MESSAGE_SCHEMA_HPP_
+
+#include <endian.h>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "constants.hpp"
+#include "frame.hpp"
+
+namespace fsm {
+  #include "flock_fsm.h"
+}
+
+namespace msg {
+
+// little-endian fields at constant offsets
+inline uint8_t getU8(const char* data, const size_t pos) {
+  return static_cast<uint8_t>(data[pos]);
+}
+inline uint32_t getU32(const char* data, const size_t pos) {
+  uint32_t value;
+  std::memcpy(&value, data + pos, 4);
+  return le32toh(value);
+}
+inline uint64_t getU64(const char* data, const size_t pos) {
+  uint64_t value;
+  std::memcpy(&value, data + pos, 8);
+  return le64toh(value);
+}
+inline void putU8(char* data, const size_t pos, const uint8_t value) {
+  data[pos] = static_cast<char>(value);
+}
+inline void putU32(char* data, const size_t pos, const uint32_t value) {
+  uint32_t value_le = htole32(value);
+  std::memcpy(data + pos, &value_le, 4);
+}
+inline void putU64(char* data, const size_t pos, const uint64_t value) {
+  uint64_t value_le = htole64(value);
+  std::memcpy(data + pos, &value_le, 8);
+}
+
+typedef std::vector< std::pair<uint64_t, uint64_t> > ranges_t;
+
+// ranges as begin/end or offset/length pairs
+static constexpr size_t range_len = 16;
+
+inline void putRanges(Frame& frame, const ranges_t& ranges) {
+  char buffer[range_len];
+  for (ranges_t::const_iterator i = ranges.begin(); i != ranges.end(); ++i) {
+    putU64(buffer, 0, i->first);
+    putU64(buffer, 8, i->second);
+    frame.putBytes(buffer, range_len);
+  }
+}
+inline void getRanges(const char* data, const size_t count, ranges_t& ranges) {
+  ranges.clear();
+  ranges.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+    ranges.push_back(std::make_pair(getU64(data, i * range_len),
+                                    getU64(data, i * range_len + 8)));
+}
+
+/**
+ * \brief An inotify event of a box, status 300 or 320: the event mask,
+ *  followed by the path relative to the box.
+ */
+struct InotifyEvent {
+  static constexpr size_t mask_pos   = 0;
+  static constexpr size_t fixed_size = 4;
+
+  uint32_t    mask;
+  const char* path;
+  size_t      path_length;
+
+  void encode(Frame& frame) const {
+    char buffer[fixed_size];
+    putU32(buffer, mask_pos, mask);
+    frame.putBytes(buffer, fixed_size).putBytes(path, path_length);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    const char* data = frame.payload();
+    mask = getU32(data, mask_pos);
+    path = data + fixed_size;
+    path_length = frame.payloadSize() - fixed_size;
+    return true;
+  }
+};
+
+/**
+ * \brief The metadata of a new file, status 130: the deadline of the
+ *  transfer, the content hash, the holes of the file and its record.
+ */
+struct FileAnnouncement {
+  static constexpr size_t deadline_pos     = 0;
+  static constexpr size_t content_hash_pos = deadline_pos + 8;
+  static constexpr size_t hole_count_pos   = content_hash_pos + F_GENERIC_HASH_LEN;
+  static constexpr size_t fixed_size       = hole_count_pos + 4;
+  // the longest record that fits into a heartbeat, without any holes
+  static constexpr size_t maximum_record_length = F_HEARTBEAT_PAYLOAD_LEN - fixed_size;
+
+  // the holes of the file that fit into a heartbeat next to its record
+  static size_t maximumHoles(const size_t record_length) {
+    if (record_length >= maximum_record_length) return 0;
+    return std::min<size_t>(F_MAXIMUM_HOLE_RANGES,
+                            (maximum_record_length - record_length) / range_len);
+  }
+
+  uint64_t             deadline;
+  const unsigned char* content_hash;
+  ranges_t             holes;
+  const char*          record;
+  size_t               record_length;
+
+  void encode(Frame& frame) const {
+    char buffer[fixed_size];
+    putU64(buffer, deadline_pos, deadline);
+    std::memcpy(buffer + content_hash_pos, content_hash, F_GENERIC_HASH_LEN);
+    putU32(buffer, hole_count_pos, holes.size());
+    frame.putBytes(buffer, fixed_size);
+    putRanges(frame, holes);
+    frame.putBytes(record, record_length);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    const char* data = frame.payload();
+    uint32_t hole_count = getU32(data, hole_count_pos);
+    if ( hole_count > F_MAXIMUM_HOLE_RANGES
+      || (frame.payloadSize() - fixed_size) / range_len < hole_count ) return false;
+    deadline = getU64(data, deadline_pos);
+    content_hash = reinterpret_cast<const unsigned char*>(data + content_hash_pos);
+    getRanges(data + fixed_size, hole_count, holes);
+    record = data + fixed_size + hole_count * range_len;
+    record_length = frame.payloadSize() - fixed_size - hole_count * range_len;
+    return true;
+  }
+};
+
+/**
+ * \brief What a node needs of a new file, status 131: the ranges it is
+ *  missing ('R'), the content hash of the version it has for a delta
+ *  ('D', 'I' if applied in place, 'S' if staged) or the whole file ('F').
+ */
+struct ResumeReply {
+  static constexpr size_t tag_pos         = 0;
+  static constexpr size_t range_count_pos = tag_pos + 1;
+  static constexpr size_t ranges_pos      = range_count_pos + 4;
+  static constexpr size_t base_pos        = tag_pos + 1;
+  static constexpr size_t mode_pos        = base_pos + F_GENERIC_HASH_LEN;
+  static constexpr size_t delta_size      = mode_pos + 1;
+
+  char                 tag;
+  ranges_t             ranges;
+  const unsigned char* base;
+  bool                 in_place;
+
+  void encode(Frame& frame) const {
+    if (tag == 'R') {
+      char buffer[ranges_pos];
+      putU8(buffer, tag_pos, 'R');
+      putU32(buffer, range_count_pos, ranges.size());
+      frame.putBytes(buffer, ranges_pos);
+      putRanges(frame, ranges);
+    } else if (tag == 'D') {
+      char buffer[delta_size];
+      putU8(buffer, tag_pos, 'D');
+      std::memcpy(buffer + base_pos, base, F_GENERIC_HASH_LEN);
+      putU8(buffer, mode_pos, in_place ? 'I' : 'S');
+      frame.putBytes(buffer, delta_size);
+    } else {
+      frame.putU8('F');
+    }
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < 1) return false;
+    const char* data = frame.payload();
+    tag = static_cast<char>(getU8(data, tag_pos));
+    if (tag == 'R') {
+      if (frame.payloadSize() < ranges_pos) return false;
+      uint32_t count = getU32(data, range_count_pos);
+      // the ranges of all nodes merged may be more than a node sends
+      if ((frame.payloadSize() - ranges_pos) / range_len < count) return false;
+      getRanges(data + ranges_pos, count, ranges);
+      return true;
+    } else if (tag == 'D') {
+      if (frame.payloadSize() < delta_size) return false;
+      base = reinterpret_cast<const unsigned char*>(data + base_pos);
+      in_place = getU8(data, mode_pos) != 'S';
+      return true;
+    }
+    return tag == 'F';
+  }
+};
+
+static_assert(ResumeReply::ranges_pos + F_MAXIMUM_RESUME_RANGES * range_len
+                <= F_HEARTBEAT_PAYLOAD_LEN,
+              "resume ranges do not fit into a heartbeat");
+
+/**
+ * \brief All data received, status 140; 'M' if chunks are still missing
+ *  and the file has to be announced again.
+ */
+struct ResendRequest {
+  bool missing;
+
+  void encode(Frame& frame) const {
+    if (missing) frame.putU8('M');
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid()) return false;
+    missing = frame.payloadSize() > 0 && frame.payload()[0] == 'M';
+    return true;
+  }
+};
+
+/**
+ * \brief The deadline of the synchronized stop, status 155.
+ */
+struct StopDeadline {
+  static constexpr size_t deadline_pos = 0;
+  static constexpr size_t fixed_size   = 8;
+
+  uint64_t deadline;
+
+  void encode(Frame& frame) const {
+    char buffer[fixed_size];
+    putU64(buffer, deadline_pos, deadline);
+    frame.putBytes(buffer, fixed_size);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    deadline = getU64(frame.payload(), deadline_pos);
+    return true;
+  }
+};
+
+/**
+ * \brief A batch of metadata changes, status 170 or 174: the number of
+ *  records, followed by the records of the files, written with one
+ *  PathCodec.
+ */
+struct MetadataChange {
+  static constexpr size_t count_pos  = 0;
+  static constexpr size_t fixed_size = 4;
+  // the records of a batch fill a heartbeat at most
+  static constexpr size_t maximum_records_length = F_HEARTBEAT_PAYLOAD_LEN - fixed_size;
+
+  uint32_t    count;
+  const char* records;
+  size_t      records_length;
+
+  void encode(Frame& frame) const {
+    char buffer[fixed_size];
+    putU32(buffer, count_pos, count);
+    frame.putBytes(buffer, fixed_size).putBytes(records, records_length);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    const char* data = frame.payload();
+    count = getU32(data, count_pos);
+    if (count == 0 || count > F_METADATA_BATCH_SIZE) return false;
+    records = data + fixed_size;
+    records_length = frame.payloadSize() - fixed_size;
+    return true;
+  }
+};
+
+// a record queued on its own always fits into a batch
+static_assert(FileAnnouncement::maximum_record_length
+                <= MetadataChange::maximum_records_length,
+              "a single metadata record may not fit into a heartbeat");
+
+/**
+ * \brief A file handed to the dispatcher, status 122 or 177: the base
+ *  directory of its box, followed by the record of the file.
+ */
+struct DispatchFile {
+  static constexpr size_t box_dir_length_pos = 0;
+  static constexpr size_t fixed_size         = 4;
+
+  const char* box_dir;
+  size_t      box_dir_length;
+  const char* record;
+  size_t      record_length;
+
+  void encode(Frame& frame) const {
+    char buffer[fixed_size];
+    putU32(buffer, box_dir_length_pos, box_dir_length);
+    frame.putBytes(buffer, fixed_size)
+         .putBytes(box_dir, box_dir_length)
+         .putBytes(record, record_length);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    const char* data = frame.payload();
+    box_dir_length = getU32(data, box_dir_length_pos);
+    if (frame.payloadSize() - fixed_size < box_dir_length) return false;
+    box_dir = data + fixed_size;
+    record = box_dir + box_dir_length;
+    record_length = frame.payloadSize() - fixed_size - box_dir_length;
+    return true;
+  }
+};
+
+/**
+ * \brief The source offset of a copy package.
+ */
+struct CopySource {
+  static constexpr size_t source_pos = 0;
+  static constexpr size_t fixed_size = 8;
+
+  uint64_t source;
+
+  void encode(char buffer[fixed_size]) const {
+    putU64(buffer, source_pos, source);
+  }
+  bool decode(const FrameView& frame) {
+    if (!frame.valid() || frame.payloadSize() < fixed_size) return false;
+    source = getU64(frame.payload(), source_pos);
+    return true;
+  }
+};
+
+/**
+ * \brief One chunk reference of a references package.
+ */
+struct ChunkReference {
+  static constexpr size_t offset_pos = 0;
+  static constexpr size_t length_pos = offset_pos + 8;
+  static constexpr size_t source_pos = length_pos + 8;
+  static constexpr size_t hash_pos   = source_pos + 8;
+  static constexpr size_t fixed_size = hash_pos + F_GENERIC_HASH_LEN;
+
+  uint64_t             offset;
+  uint64_t             length;
+  uint64_t             source;
+  const unsigned char* hash;
+
+  void encode(char buffer[fixed_size]) const {
+    putU64(buffer, offset_pos, offset);
+    putU64(buffer, length_pos, length);
+    putU64(buffer, source_pos, source);
+    std::memcpy(buffer + hash_pos, hash, F_GENERIC_HASH_LEN);
+  }
+  // decodes the reference at index of the package
+  bool decode(const FrameView& frame, const size_t index) {
+    if ( !frame.valid()
+      || frame.payloadSize() / fixed_size <= index ) return false;
+    const char* data = frame.payload() + index * fixed_size;
+    offset = getU64(data, offset_pos);
+    length = getU64(data, length_pos);
+    source = getU64(data, source_pos);
+    hash = reinterpret_cast<const unsigned char*>(data + hash_pos);
+    return true;
+  }
+};
+static_assert(ChunkReference::fixed_size == F_CHUNK_REFERENCE_LEN,
+              "chunk reference layout does not match F_CHUNK_REFERENCE_LEN");
+
+/**
+ * \brief Payload of the heartbeats of a status; statuses without one
+ *  carry none.
+ */
+template <fsm::status_t S> struct heartbeat_schema { typedef void type; };
+template <> struct heartbeat_schema<fsm::status_130> { typedef FileAnnouncement type; };
+template <> struct heartbeat_schema<fsm::status_131> { typedef ResumeReply type; };
+template <> struct heartbeat_schema<fsm::status_140> { typedef ResendRequest type; };
+template <> struct heartbeat_schema<fsm::status_155> { typedef StopDeadline type; };
+template <> struct heartbeat_schema<fsm::status_170> { typedef MetadataChange type; };
+template <> struct heartbeat_schema<fsm::status_174> { typedef MetadataChange type; };
+
+/**
+ * \brief Pads a heartbeat to F_HEARTBEAT_LEN, so the heartbeats of all
+ *  statuses look alike on the wire; false, and left as it is, if its
+ *  payload is too long for that.
+ */
+inline bool sealHeartbeat(Frame& frame) {
+  if (frame.size() > F_HEARTBEAT_LEN) return false;
+  frame.pad(F_HEARTBEAT_LEN);
+  return true;
+}
+
+/**
+ * \brief Decodes the payload of a heartbeat of status S.
+ */
+template <fsm::status_t S, typename T>
+inline bool decode(const FrameView& frame, T& message) {
+  static_assert(std::is_same<T, typename heartbeat_schema<S>::type>::value,
+                "payload does not belong to this status");
+  return frame.status() == S && message.decode(frame);
+}
+
+}  // namespace msg
+
+#endif  // INCLUDE_MESSAGE_SCHEMA_HPP_
@@ -0,0 +1,47 @@
+/**
+ * \file      path_codec.hpp
+ * \brief     Wire encoding of the paths in file metadata records. 
+ *
+ *  Paths are sent with a length prefix instead of being padded to a 
+ *  fixed size. Within a batch of records, each path only carries what 
+ *  differs from the path of the previous record. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_PATH_CODEC_HPP_
+#define INCLUDE_PATH_CODEC_HPP_
+
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+#include "constants.hpp"
+
+/**
+ * \brief Encodes and decodes length-prefixed paths. 
+ *
+ *  A path is written as the length of the prefix it shares with the 
+ *  previous path, the length of the remaining suffix, both as 
+ *  variable-length integers, and the suffix itself. A fresh PathCodec 
+ *  has no previous path, so a single record costs two bytes on top of 
+ *  the path for paths shorter than 128 characters. Both sides of a 
+ *  batch have to use one PathCodec for all of its records. 
+ */
+class PathCodec {
+ public:
+    PathCodec() : previous_() {}
+
+    void encode(std::ostream& ostream, const std::string& path);
+    bool decode(std::istream& istream, std::string& path);
+    void reset();
+
+    static void writeVarint(std::ostream& ostream, uint64_t value);
+    static bool readVarint(std::istream& istream, uint64_t& value);
+
+ private:
+    std::string previous_;
+};
+
+#endif  // INCLUDE_PATH_CODEC_HPP_
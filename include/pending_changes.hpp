@@ -0,0 +1,61 @@
+/**
+ * \file      pending_changes.hpp
+ * \brief     Local changes of a box waiting to be announced.
+ *
+ *  inotify reports a file that is being written many times over. Every
+ *  report used to be queued and sent on its own, although only the
+ *  last version of the file matters. PendingChanges keeps at most one
+ *  change per path in the order the paths first changed; a later
+ *  change of a path takes the place of the earlier one.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_PENDING_CHANGES_HPP_
+#define INCLUDE_PENDING_CHANGES_HPP_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "file.hpp"
+
+/**
+ * \brief Queue of changed files with an index by their path.
+ *
+ *  Every operation takes constant time. The queue does not own the
+ *  files; files it replaces or cancels are handed back to the caller.
+ */
+class PendingChanges {
+ public:
+    typedef std::list<File*>::const_iterator const_iterator;
+
+    PendingChanges();
+    PendingChanges(const PendingChanges&) = delete;
+    PendingChanges& operator=(const PendingChanges&) = delete;
+
+    // queues the file at the end, or in place of the file pending for
+    // the same path, which is returned then
+    File* push_back(File* file);
+    // queues the file first, unless a newer version is pending already
+    bool push_front(File* file);
+    File* front() const;
+    void pop_front();
+    // takes the file pending for the path out of the queue; the first
+    // one is left if keep_front is set
+    File* cancel(const std::string& path, const bool keep_front = false);
+
+    bool has(const std::string& path) const;
+    bool empty() const;
+    size_t size() const;
+    // the files in the order they are going to be sent
+    const_iterator begin() const;
+    const_iterator end() const;
+
+ private:
+    std::list<File*>                                            order_;
+    std::unordered_map<std::string, std::list<File*>::iterator> index_;
+};
+
+#endif  // INCLUDE_PENDING_CHANGES_HPP_
@@ -0,0 +1,72 @@
+/**
+ * \file      prefetcher.hpp
+ * \brief     Read-ahead of outgoing file data. 
+ *
+ *  The dispatcher sends one package per send slot. Reading the data 
+ *  only when the slot opens makes every slot wait for the disk on a 
+ *  cold page cache. A Prefetcher reads the data of a transfer ahead in 
+ *  a separate thread, so it is already in memory when it is needed. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_PREFETCHER_HPP_
+#define INCLUDE_PREFETCHER_HPP_
+
+#include <vector>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <sys/types.h>
+
+#include "constants.hpp"
+
+/**
+ * \brief Reads given ranges of a file ahead into a ring buffer. 
+ *
+ *  The reader thread fills up to F_PREFETCH_DEPTH blocks of 
+ *  F_PREFETCH_BLOCK_SIZE bytes and advises the kernel of the blocks 
+ *  after those. read() behaves like pread(); reads that follow the 
+ *  ranges in order are served from the buffer, all others go to the 
+ *  file directly. Blocks are released once they have been read past. 
+ *  The file descriptor stays owned by the caller and must not be closed 
+ *  before the Prefetcher has been stopped. 
+ */
+class Prefetcher {
+ public:
+    Prefetcher(const int fd,
+               const std::vector< std::pair<uint64_t, uint64_t> >& ranges);
+    Prefetcher(const Prefetcher&) = delete;
+    ~Prefetcher();
+
+    ssize_t read(void* data, const size_t length, const uint64_t offset);
+    void stop();
+
+    static void advise(const int fd, const uint64_t offset, const uint64_t length);
+
+ private:
+    struct block_t {
+      uint64_t           offset;
+      uint64_t           length;
+      std::vector<char>  data;
+    };
+
+    void run();
+
+    int                                          fd_;
+    std::vector< std::pair<uint64_t, uint64_t> > ranges_;
+    std::vector<block_t>                         blocks_;
+    size_t                                       head_;
+    size_t                                       count_;
+    bool                                         done_;
+    bool                                         stop_;
+    std::mutex                                   mutex_;
+    std::condition_variable                      filled_;
+    std::condition_variable                      released_;
+    std::thread                                  reader_;
+};
+
+#endif  // INCLUDE_PREFETCHER_HPP_
@@ -11,18 +11,22 @@
 #define F_PUBLISHER_HPP
 
 #include <zmqpp/zmqpp.hpp>
+#include <vector>
 
 #include "transmitter.hpp"
 #include "config.hpp"
+#include "reactor.hpp"
 
 class Publisher : public Transmitter
 {
   public:
     Publisher() :
       Transmitter(), 
-      z_heartbeater(nullptr),
-      z_dispatcher(nullptr),
+      pub_hb_channel(nullptr),
+      pub_disp_channels(),
       z_publisher(nullptr),
+      authenticator(nullptr),
+      node_hash(),
       data()
       {};
     Publisher(zmqpp::context* z_ctx_, host_t data_);
@@ -30,14 +34,20 @@ class Publisher : public Transmitter
     ~Publisher();
 
     int run();
+    int attach(Reactor& reactor);
 
   private:
     int connectToHeartbeater();
     int connectToDispatcher();
+    void publish(Frame& message);
 
-    zmqpp::socket* z_heartbeater;
-    zmqpp::socket* z_dispatcher;
+    FrameChannel*  pub_hb_channel;
+    // one for the dispatcher of every box
+    std::vector<FrameChannel*> pub_disp_channels;
     zmqpp::socket* z_publisher;
+    zmqpp::auth*   authenticator;
+    // every frame published is stamped with the id of this node
+    Hash           node_hash;
     host_t         data;
 };
 
@@ -0,0 +1,75 @@
+/**
+ * \file      reactor.hpp
+ * \brief     Event loop over the sockets and file descriptors of a thread.
+ *
+ *  Every thread registers its sockets, channels and descriptors once
+ *  and then either dispatches to handlers with run() or pulls messages
+ *  with receive(). Sources are served in the order they were added, so
+ *  the broadcast goes first and an interrupt is never stuck behind
+ *  other messages. After a wakeup, all ready sockets and channels are
+ *  drained before the reactor polls again, up to F_REACTOR_BATCH
+ *  messages per source.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_REACTOR_HPP_
+#define INCLUDE_REACTOR_HPP_
+
+#include <zmqpp/zmqpp.hpp>
+#include <functional>
+#include <vector>
+
+#include "constants.hpp"
+
+// messages taken from one source per wakeup before the others get a turn
+#define F_REACTOR_BATCH 64
+
+class Reactor {
+ public:
+    // handlers return false to stop run()
+    typedef std::function<bool(zmqpp::message&)> message_handler_t;
+    typedef std::function<bool(Frame&)>          frame_handler_t;
+    typedef std::function<bool()>                fd_handler_t;
+
+    Reactor();
+
+    // all return the index of the source
+    int add(zmqpp::socket& socket, message_handler_t handler = nullptr);
+    int add(FrameChannel& channel, frame_handler_t handler = nullptr);
+    int add(const int fd, fd_handler_t handler = nullptr);
+
+    // next message of any socket or channel or next ready descriptor, 
+    // whose data is left to the caller; -1 if nothing got ready within 
+    // timeout ms. frame views the message or the frame taken from a 
+    // channel until the next call. 
+    int receive(zmqpp::message& z_msg, FrameView& frame,
+                const long timeout = zmqpp::poller::wait_forever);
+    int receive(zmqpp::message& z_msg, const long timeout = zmqpp::poller::wait_forever);
+    // dispatches to the handlers until one of them returns false
+    void run();
+
+ private:
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    struct source_t {
+      zmqpp::socket*    socket;
+      FrameChannel*     channel;
+      int               fd;
+      message_handler_t on_message;
+      frame_handler_t   on_frame;
+      fd_handler_t      on_ready;
+      bool              ready;
+      int               batch;
+    };
+
+    zmqpp::poller         poller_;
+    std::vector<source_t> sources_;
+    zmqpp::message        z_msg_;
+    // the frame last taken from a channel
+    Frame                 frame_;
+};
+
+#endif  // INCLUDE_REACTOR_HPP_
@@ -0,0 +1,57 @@
+/**
+ * \file      reply_set.hpp
+ * \brief     Bitmap of the nodes that replied in the current round.
+ *
+ *  Every node gets a dense index when the configuration is read, see
+ *  node_t. A round of replies then is a bitmap over these indices with
+ *  a count of the bits set, so marking a node and asking whether all
+ *  nodes replied take constant time.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_REPLY_SET_HPP_
+#define INCLUDE_REPLY_SET_HPP_
+
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class ReplySet {
+ public:
+    ReplySet() : words_(), count_(0) {}
+
+    // false if the node replied already in this round
+    bool insert(const size_t node) {
+      const size_t word = node / 64;
+      const uint64_t bit = static_cast<uint64_t>(1) << (node % 64);
+      if ( word >= words_.size() ) words_.resize(word + 1, 0);
+      if ( words_[word] & bit ) return false;
+      words_[word] |= bit;
+      ++count_;
+      return true;
+    }
+
+    bool has(const size_t node) const {
+      const size_t word = node / 64;
+      return word < words_.size()
+          && (words_[word] & (static_cast<uint64_t>(1) << (node % 64))) != 0;
+    }
+
+    size_t size() const { return count_; }
+
+    // one word per 64 nodes, nothing to do if no node replied
+    void clear() {
+      if ( count_ == 0 ) return;
+      std::fill(words_.begin(), words_.end(), 0);
+      count_ = 0;
+    }
+
+ private:
+    std::vector<uint64_t> words_;
+    size_t                count_;
+};
+
+#endif  // INCLUDE_REPLY_SET_HPP_
@@ -0,0 +1,74 @@
+/**
+ * \file      small_string.hpp
+ * \brief     String with inline storage for short contents. 
+ *
+ *  Most paths within a box are short. A SmallString keeps up to N 
+ *  characters inside the object and only allocates for longer ones, 
+ *  so the Files of a large box do not cost one allocation each. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_SMALL_STRING_HPP_
+#define INCLUDE_SMALL_STRING_HPP_
+
+#include <string>
+#include <cstring>
+#include <cstddef>
+
+/**
+ * \brief String with inline storage for up to N characters. 
+ */
+template <size_t N>
+class SmallString {
+ public:
+    SmallString() : data_(local_), size_(0) { local_[0] = '\0'; }
+    explicit SmallString(const std::string& s) : SmallString() { assign(s.data(), s.size()); }
+    SmallString(const SmallString& other) : SmallString() { assign(other.data_, other.size_); }
+    ~SmallString() { release(); }
+
+    SmallString& operator=(const SmallString& other) {
+      if (this != &other) assign(other.data_, other.size_);
+      return *this;
+    }
+    SmallString& operator=(const std::string& s) {
+      assign(s.data(), s.size());
+      return *this;
+    }
+
+    void assign(const char* data, const size_t size) {
+      if (size > N) {
+        char* heap = new char[size + 1];
+        std::memcpy(heap, data, size);
+        release();
+        data_ = heap;
+      } else {
+        // data may point into our own storage
+        std::memmove(local_, data, size);
+        release();
+        data_ = local_;
+      }
+      size_ = size;
+      data_[size_] = '\0';
+    }
+
+    const char* c_str() const { return data_; }
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool isInline() const { return data_ == local_; }
+    std::string str() const { return std::string(data_, size_); }
+
+ private:
+    char    local_[N + 1];
+    char*   data_;
+    size_t  size_;
+
+    void release() {
+      if (data_ != local_) delete[] data_;
+      data_ = local_;
+    }
+};
+
+#endif  // INCLUDE_SMALL_STRING_HPP_
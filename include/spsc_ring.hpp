@@ -0,0 +1,89 @@
+/**
+ * \file      spsc_ring.hpp
+ * \brief     Lock-free single-producer/single-consumer ring with an eventfd.
+ *
+ *  One thread pushes, one thread pops. The producer only writes the
+ *  eventfd when it pushes into an empty ring, so a consumer draining a
+ *  busy ring is not woken for every element. The consumer polls fd()
+ *  together with its sockets, calls clearWakeup() and then pops until
+ *  the ring is empty.
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#ifndef INCLUDE_SPSC_RING_HPP_
+#define INCLUDE_SPSC_RING_HPP_
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#define F_CACHE_LINE 64
+
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert((Capacity & (Capacity - 1)) == 0, "capacity has to be a power of two");
+
+ public:
+    SpscRing() : head_(0), head_pad_(), tail_(0), tail_pad_(), slots_(), fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+      if ( fd_ < 0 ) throw std::runtime_error("could not create eventfd");
+    }
+    ~SpscRing() { close(fd_); }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    int fd() const { return fd_; }
+
+    // producer side; false if the ring is full
+    bool push(T&& value) {
+      const size_t tail = tail_.load(std::memory_order_relaxed);
+      if ( tail - head_.load(std::memory_order_acquire) == Capacity ) return false;
+      slots_[tail & (Capacity - 1)] = std::move(value);
+      tail_.store(tail + 1);
+      // sequentially consistent with the store of the consumer, so
+      // either the consumer sees the element or the producer sees it
+      // drained the ring and wakes it
+      if ( head_.load() == tail ) signal();
+      return true;
+    }
+
+    // consumer side; false if the ring is empty
+    bool pop(T& value) {
+      const size_t head = head_.load(std::memory_order_relaxed);
+      if ( head == tail_.load() ) return false;
+      value = std::move(slots_[head & (Capacity - 1)]);
+      head_.store(head + 1);
+      return true;
+    }
+
+    bool empty() const { return head_.load() == tail_.load(); }
+
+    // consumer side, before draining
+    void clearWakeup() {
+      uint64_t count;
+      if ( read(fd_, &count, sizeof(count)) < 0 ) return;
+    }
+    // wakes the consumer, e.g. when it left elements for its next round
+    void signal() {
+      const uint64_t one = 1;
+      if ( write(fd_, &one, sizeof(one)) < 0 ) return;
+    }
+
+ private:
+    // padded apart, so producer and consumer do not share a cache line;
+    // alignas would need the aligned new of C++17
+    std::atomic<size_t> head_;
+    char                head_pad_[F_CACHE_LINE - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> tail_;
+    char                tail_pad_[F_CACHE_LINE - sizeof(std::atomic<size_t>)];
+    T                   slots_[Capacity];
+    int                 fd_;
+};
+
+#endif  // INCLUDE_SPSC_RING_HPP_
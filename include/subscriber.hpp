@@ -12,6 +12,7 @@
 
 #include "transmitter.hpp"
 #include "config.hpp"
+#include "reactor.hpp"
 
 class Subscriber : public Transmitter
 {
@@ -26,6 +27,7 @@ class Subscriber : public Transmitter
     ~Subscriber();
 
     int run();
+    int attach(Reactor& reactor);
 
   private:
     zmqpp::socket* z_subscriber;
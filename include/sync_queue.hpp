@@ -0,0 +1,68 @@
+/**
+ * \file      sync_queue.hpp
+ * \brief     Groups the fsyncs of received files. 
+ *
+ *  Files that have been completely received are handed to the SyncQueue 
+ *  instead of being fsynced one by one. Every configured interval the 
+ *  queue syncs all pending files, moves staged files over their targets 
+ *  and syncs each affected directory once. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_SYNC_QUEUE_HPP_
+#define INCLUDE_SYNC_QUEUE_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <boost/filesystem.hpp>
+
+#include "constants.hpp"
+
+/**
+ * \brief Batches fsyncs and renames of received files. 
+ *
+ *  The SyncQueue is a singleton that shall only be used within the 
+ *  boxoffice thread. It takes ownership of the file descriptors handed 
+ *  to it and closes them once they have been synced. 
+ */
+class SyncQueue {
+ public:
+    SyncQueue(const SyncQueue&) = delete;
+    SyncQueue& operator=(const SyncQueue&) = delete;
+
+    static SyncQueue* getInstance() {
+      static SyncQueue sq_instance_;
+      return &sq_instance_;
+    }
+
+    void setInterval(uint32_t interval);
+
+    void add(int fd, const boost::filesystem::path& target);
+    void add(int fd,
+             const boost::filesystem::path& staging,
+             const boost::filesystem::path& target);
+
+    void flushIfDue();
+    void flush();
+
+ private:
+    SyncQueue() :
+      pending_(),
+      interval_(F_FSYNC_INTERVAL_DEFAULT),
+      last_flush_(0) {}
+    ~SyncQueue();
+
+    struct entry_t {
+      int                     fd;
+      boost::filesystem::path staging;
+      boost::filesystem::path target;
+    };
+
+    std::vector<entry_t> pending_;
+    uint32_t             interval_;
+    uint64_t             last_flush_;
+};
+
+#endif  // INCLUDE_SYNC_QUEUE_HPP_
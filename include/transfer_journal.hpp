@@ -0,0 +1,78 @@
+/**
+ * \file      transfer_journal.hpp
+ * \brief     Persistent per-chunk completion state of a received file. 
+ *
+ *  For every file that is being received a TransferJournal records the 
+ *  identity of the file (size, mtime and the expected content hash) and 
+ *  which chunks have already been stored. The journal is kept on disk, 
+ *  so after a restart or a dropped link only the missing ranges of a 
+ *  file need to be transmitted again. 
+ *
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#ifndef INCLUDE_TRANSFER_JOURNAL_HPP_
+#define INCLUDE_TRANSFER_JOURNAL_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <cstdint>
+
+#include "hash.hpp"
+
+/**
+ * \brief Persistent chunk bitmap of a file transfer. 
+ *
+ *  A chunk is F_MAXIMUM_FILE_PACKAGE_SIZE bytes long, the last one may 
+ *  be shorter. Ranges that do not cover a chunk completely are counted 
+ *  in memory until the chunk is complete; only complete chunks are 
+ *  persisted. Changes are written back every F_JOURNAL_SYNC_CHUNKS 
+ *  chunks and when the journal is closed. 
+ */
+class TransferJournal {
+ public:
+    TransferJournal(const std::string& journal_dir,
+                    const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                    const std::string& path);
+    TransferJournal(const TransferJournal&) = delete;
+    ~TransferJournal();
+
+    bool open(const uint64_t size,
+              const uint32_t mtime,
+              const unsigned char content_hash[F_GENERIC_HASH_LEN]);
+    void reset();
+    void remove();
+    void sync();
+
+    void markRange(const uint64_t offset, const uint64_t length);
+    bool hasChunk(const uint64_t index) const;
+    bool complete() const;
+
+    uint64_t getChunkCount() const;
+    uint64_t getMissingChunkCount() const;
+    const unsigned char* getContentHash() const;
+    std::vector< std::pair<uint64_t, uint64_t> >
+        getMissingRanges(const size_t max_ranges) const;
+
+ private:
+    void markChunk(const uint64_t index);
+    uint64_t getChunkLength(const uint64_t index) const;
+
+    std::string                             journal_path_;
+    int                                     fd_;
+    uint64_t                                size_;
+    uint32_t                                mtime_;
+    unsigned char                           content_hash_[F_GENERIC_HASH_LEN];
+    uint64_t                                chunk_count_;
+    uint64_t                                missing_;
+    std::vector<uint8_t>                    bitmap_;
+    std::unordered_map<uint64_t, uint64_t>  partial_;
+    uint64_t                                dirty_begin_;
+    uint64_t                                dirty_end_;
+    uint64_t                                unsynced_;
+};
+
+#endif  // INCLUDE_TRANSFER_JOURNAL_HPP_
@@ -8,6 +8,8 @@
 
 #include <zmqpp/zmqpp.hpp>
 
+class Reactor;
+
 namespace fsm {
   #include "flock_fsm.h"
 }
@@ -32,6 +34,10 @@ class Transmitter
     }
     virtual int sendExitSignal();
     virtual int run() = 0;
+    // registers the transmitter on a reactor it shares with others instead 
+    // of running a loop of its own; transmitters that can not share one 
+    // return 1
+    virtual int attach(Reactor& reactor) { (void)reactor; return 1; }
 
   protected:
     zmqpp::context* z_ctx;
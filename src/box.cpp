@@ -11,6 +11,7 @@
 
 #include "constants.hpp"
 #include "directory.hpp"
+#include "message_schema.hpp"
 
 #include <stdio.h>
 #include <iostream>
@@ -24,7 +25,10 @@ Box::Box() :
   path_(),
   entries_(),
   hash_tree_(),
-  box_hash_()
+  box_hash_(),
+  bo_channel_(nullptr),
+  inotify_fd_(-1),
+  inotify_buffer_()
   {}
 
 Box::Box(zmqpp::context* z_ctx_,
@@ -34,7 +38,10 @@ Box::Box(zmqpp::context* z_ctx_,
   path_(p),
   entries_(),
   hash_tree_(),
-  box_hash_(new unsigned char[F_GENERIC_HASH_LEN])
+  box_hash_(new unsigned char[F_GENERIC_HASH_LEN]),
+  bo_channel_(s_channel("box", box_hash)),
+  inotify_fd_(-1),
+  inotify_buffer_()
   {
     tac = (char*)"box";
     Directory* baseDir = new Directory();
@@ -66,6 +73,8 @@ Box::~Box()
   watch_descriptors_.clear();
 
   delete hash_tree_;
+
+  if ( inotify_fd_ >= 0 ) close(inotify_fd_);
 }
 
 void Box::recursiveDirectoryFill(
@@ -100,74 +109,84 @@ bool Box::getChangedDirHashes(std::vector< std::shared_ptr<Hash> >* changed_hash
 
 int Box::run()
 {
-  // defining fd 
-  int fd, wd;
+  Reactor reactor;
+  if ( attach(reactor) != 0 ) return 1;
+  reactor.run();
+
+  return 0;
+}
 
-  fd = inotify_init();
-  if ( fd < 0 ) return 1;
+int Box::attach(Reactor& reactor)
+{
+  inotify_fd_ = inotify_init();
+  if ( inotify_fd_ < 0 ) return 1;
 
   // for each directory, add a watch
   for (std::unordered_map<std::string,Directory*>::iterator i = 
        entries_.begin(); i != entries_.end(); ++i)
   {
-    wd = inotify_add_watch( fd, i->second->getAbsolutePath().c_str(), F_IN_EVENT_MASK );
+    int wd = inotify_add_watch( inotify_fd_, i->second->getAbsolutePath().c_str(), F_IN_EVENT_MASK );
     watch_descriptors_.insert(std::make_pair(wd,i->second));
   }
 
-  std::stringstream* sstream;
-  int msg_type, msg_signal;
-  while(true)
-  {
-    sstream = new std::stringstream();
-    s_recv_in(*z_broadcast, *z_boxoffice_push, fd, *sstream);
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type == F_SIGTYPE_LIFE && msg_signal == F_SIGLIFE_INTERRUPT ) 
-    {
-      delete sstream;
-      break;
-    }
+  inotify_buffer_.resize(F_IN_BUF_LEN);
+  Reactor::message_handler_t control = [](zmqpp::message& z_msg) {
+    FrameView frame = s_frame(z_msg);
+    return !(    frame.valid()
+              && frame.type() == F_SIGTYPE_LIFE
+              && frame.status() == F_SIGLIFE_INTERRUPT );
+  };
+  Reactor::fd_handler_t watch = [this]() {
+    ssize_t length = read( inotify_fd_, inotify_buffer_.data(), inotify_buffer_.size() );
+    if ( length < 0 ) perror("inotify poll");
+    else sendInotifyEvents(inotify_buffer_.data(), length);
+    return true;
+  };
+
+  reactor.add(*z_broadcast, control);
+  reactor.add(*z_boxoffice_push, control);
+  reactor.add(inotify_fd_, watch);
+
+  return 0;
+}
 
-    // sending inotify event
-    int wd;
-    std::string dir_path, name;
-    *sstream >> wd >> name;
-    dir_path = getPathOfDirectory(wd);
-
-    int inotify_mask = msg_signal;
-    if ((inotify_mask & IN_DELETE_SELF) != IN_DELETE_SELF) {
-      fsm::status_t status;
-      if (        ((inotify_mask & IN_MODIFY)      == IN_MODIFY)
-               || ((inotify_mask & IN_MOVE)        == IN_MOVE)
-               || ((inotify_mask & IN_MOVE_SELF)   == IN_MOVE_SELF) ) {
-        // fsm::new_local_file_event;
-        status = fsm::status_300;
-      } else if ( ((inotify_mask & IN_CREATE)      == IN_CREATE)
-               || ((inotify_mask & IN_ATTRIB)      == IN_ATTRIB)
-               || ((inotify_mask & IN_DELETE)      == IN_DELETE) ) {
-        // fsm::local_file_metadata_change_event;
-        status = fsm::status_320;
-      }
-
-      std::stringstream message;
-      message << F_SIGTYPE_INOTIFY << " "
-              << status             << " "
-              << inotify_mask;
-      message.write(reinterpret_cast<char*>(box_hash_), F_GENERIC_HASH_LEN);
-      message << " " << dir_path    << "/"
-              << name.c_str();
-
-      zmqpp::message* z_msg = new zmqpp::message();
-      *z_msg << message.str();
-      z_boxoffice_pull->send(*z_msg);
-      delete z_msg;
+// sends every inotify event of a read as a frame of its own
+void Box::sendInotifyEvents(const char* buffer, const ssize_t length)
+{
+  ssize_t i = 0;
+  while ( i < length )
+  {
+    const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(&buffer[i]);
+    i += F_IN_EVENT_SIZE + event->len;
+    if ( watch_descriptors_.count(event->wd) == 0 ) continue;
+
+    std::string name = event->len > 0 ? event->name : "";
+    // staged files are still being received and must not be announced
+    if (name.compare(0, std::strlen(F_STAGING_PREFIX), F_STAGING_PREFIX) == 0) continue;
+
+    uint32_t inotify_mask = event->mask;
+    if ((inotify_mask & IN_DELETE_SELF) == IN_DELETE_SELF) continue;
+
+    fsm::status_t status = fsm::status_320;
+    if (        ((inotify_mask & IN_MODIFY)      == IN_MODIFY)
+             || ((inotify_mask & IN_MOVE)        != 0)
+             || ((inotify_mask & IN_MOVE_SELF)   == IN_MOVE_SELF) ) {
+      // fsm::new_local_file_event;
+      status = fsm::status_300;
+    } else if ( ((inotify_mask & IN_CREATE)      == IN_CREATE)
+             || ((inotify_mask & IN_ATTRIB)      == IN_ATTRIB)
+             || ((inotify_mask & IN_DELETE)      == IN_DELETE) ) {
+      // fsm::local_file_metadata_change_event;
+      status = fsm::status_320;
     }
 
-    delete sstream;
+    std::string path = getPathOfDirectory(event->wd) + "/" + name;
+    msg::InotifyEvent payload = { inotify_mask, path.data(), path.size() };
+    Frame message(F_SIGTYPE_INOTIFY, status);
+    message.setBox(box_hash_);
+    payload.encode(message);
+    s_send(*bo_channel_, message);
   }
-
-  close(fd);
-
-  return 0;
 }
 
 const std::string Box::getBaseDir() const
@@ -184,6 +203,9 @@ const std::string Box::getAbsolutePathOfDirectory(int wd) const
 const unsigned char* Box::getBoxHash() const {
   return box_hash_;
 }
+FrameChannel* Box::getChannel() const {
+  return bo_channel_;
+}
 
 void Box::printDirectories() const
 {
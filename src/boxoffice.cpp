@@ -11,7 +11,11 @@
 #include <fstream>
 #include <endian.h>
 #include <sys/inotify.h>
+#include <sys/stat.h>
 #include <sodium.h>
+#include <algorithm>
+#include <poll.h>
+#include <cerrno>
 
 #include "file.hpp"
 #include "constants.hpp"
@@ -20,12 +24,21 @@
 #include "heartbeater.hpp"
 #include "dispatcher.hpp"
 #include "subscriber.hpp"
+#include "sync_queue.hpp"
+#include "reactor.hpp"
+#include "transfer_journal.hpp"
+#include "delta.hpp"
+#include "chunker.hpp"
+#include "compression.hpp"
+#include "message_schema.hpp"
+#include "content_hasher.hpp"
 
 void *publisher_thread(zmqpp::context*, host_t host);
 void *heartbeater_thread(zmqpp::context*, fsm::status_t status);
-void *dispatcher_thread(zmqpp::context*, fsm::status_t status);
+void *dispatcher_thread(zmqpp::context*, fsm::status_t status, const unsigned char* box_hash);
 void *subscriber_thread(zmqpp::context*, node_t node);
 void *box_thread(Box* box);
+void *reactor_thread(zmqpp::context*, reactor_shard_t shard);
 
 Boxoffice::~Boxoffice()
 {
@@ -41,12 +54,28 @@ Boxoffice::~Boxoffice()
   for (std::vector<boost::thread*>::iterator i = box_threads.begin(); i != box_threads.end(); ++i)
     delete *i;
 
+  // the sessions own the files they queued and the one they sent last, 
+  // which may be queued again for a resend
+  for (session_map::iterator i = sessions_.begin(); i != sessions_.end(); ++i)
+    for (std::vector<box_session_t*>::iterator j = i->begin(); j != i->end(); ++j) {
+      box_session_t* session = *j;
+      bool queued = false;
+      for (PendingChanges::const_iterator k = session->file_list_data.begin();
+           k != session->file_list_data.end(); ++k) {
+        queued = queued || *k == session->sending_file;
+        delete *k;
+      }
+      for (PendingChanges::const_iterator k = session->file_list_metadata.begin();
+           k != session->file_list_metadata.end(); ++k)
+        delete *k;
+      if (!queued) delete session->sending_file;
+      delete session;
+    }
+
   // deleting sockets
   delete z_bo_main;
   delete z_router;
   delete z_bo_pub;
-  delete z_bo_hb;
-  delete z_bo_disp;
   delete z_broadcast;
 }
 
@@ -58,7 +87,22 @@ Boxoffice* Boxoffice::initialize(zmqpp::context* z_ctx)
 
   Config* conf = Config::getInstance();
   bo->subscribers = conf->getNodes();
+  // node_t live in the map, which never moves them
+  for (node_map::iterator i = bo->subscribers.begin(); i != bo->subscribers.end(); ++i) {
+    i->second.index = bo->peer_ids_.intern(i->first->getBytes());
+    bo->peers_.push_back(&i->second);
+  }
   bo->publishers = conf->getHosts();
+  for (std::vector< host_t >::iterator i = bo->publishers.begin(); i != bo->publishers.end(); ++i)
+    bo->node_ids_.push_back(s_node_id(Hash(i->keypair.public_key).getBytes()));
+  bo->staging_ = conf->getStaging();
+  bo->pipelined_ = conf->getPipelined();
+  bo->heartbeat_tick_ = std::max<uint32_t>(conf->getHeartbeatInterval() / F_HEARTBEAT_TICKS, 1);
+  bo->offset_multiplier_ = conf->getOffsetMultiplier();
+  bo->offset_floor_ = conf->getOffsetFloor();
+  bo->journal_dir_ = conf->getJournalDir();
+  SyncQueue::getInstance()->setInterval(conf->getFsyncInterval());
+  ChunkStore::getInstance()->setDirectory(conf->getChunkStoreDir());
 
   // setting up
   return_value = bo->setContext(z_ctx);
@@ -73,6 +117,7 @@ Boxoffice* Boxoffice::initialize(zmqpp::context* z_ctx)
   if (return_value == 0) return_value = bo->setupHeartbeaters();
   if (return_value == 0) return_value = bo->setupDispatchers();
   if (return_value == 0) return_value = bo->setupSubscribers();
+  if (return_value == 0) return_value = bo->setupReactors();
   if (return_value == 0) return_value = bo->checkChildren();
   if (return_value == 0) return_value = bo->runRouter();
 
@@ -122,12 +167,10 @@ int Boxoffice::setupConnectionToChildren()
   // connection to send information to publishers and boxes
   z_bo_pub = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pub);
   z_bo_pub->bind("inproc://f_boxoffice_push_out");
-  // connection to send information to heartbeaters
-  z_bo_hb = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pub);
-  z_bo_hb->bind("inproc://f_boxoffice_hb_push_out");
-  // connection to send information to dispatchers
-  z_bo_disp = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pub);
-  z_bo_disp->bind("inproc://f_boxoffice_disp_push_out");
+  // channels to send information to the heartbeater and the dispatchers 
+  // of the boxes; like the PUB sockets they replaced, they drop frames 
+  // when nobody takes them, e.g. without any publishers
+  bo_hb_channel = s_channel("bo_hb");
   if (F_MSG_DEBUG) printf("bo: starting to listen to children...\n");
 
   return 0;
@@ -137,17 +180,33 @@ int Boxoffice::setupBoxes()
 {
   Config* conf = Config::getInstance();
   std::map< std::string, box_t > box_dirs = conf->getBoxes();
+  // with shared reactors, boxes, publishers and subscribers are only 
+  // assigned to a shard here and started by setupReactors
+  shards_.resize(conf->getReactorThreads());
 
   box_threads.reserve(box_dirs.size());
   if (F_MSG_DEBUG) printf("bo: opening %d box threads\n", (int)box_dirs.size());
   for (std::map<std::string,box_t>::iterator i = box_dirs.begin(); i != box_dirs.end(); ++i)
   {
+    // a box configured under two paths is set up once
+    if ( box_ids_.find(i->second.uid) >= 0 ) continue;
     // initializing the boxes here, so we can use file IO while it's thread 
     // still listens to inotify events
     Box* box = new Box(z_ctx, i->second.base_path, i->second.uid);
     Hash* hash = new Hash(i->second.uid);
-    boxes.insert(std::make_pair(hash,box));
-
+    box_ids_.intern(i->second.uid);
+    boxes.push_back(box);
+    // all lanes exist whether pipelined or not, other nodes may be
+    sessions_.push_back(std::vector<box_session_t*>());
+    std::vector<box_session_t*>& lanes = sessions_.back();
+    for (uint8_t lane = 0; lane < F_PIPELINE_LANES; ++lane)
+      lanes.push_back(new box_session_t(hash, box, lane));
+    ++children_;
+
+    if (!shards_.empty()) {
+      shards_[(children_ - 1) % shards_.size()].boxes.push_back(box);
+      continue;
+    }
     // opening box thread
     boost::thread* bt = new boost::thread(box_thread, box);
     box_threads.push_back(bt);
@@ -164,9 +223,15 @@ int Boxoffice::setupPublishers()
 
   // opening publisher threads
   if (F_MSG_DEBUG) printf("bo: opening %d publisher threads\n", (int)publishers.size());
+  size_t shard = 0;
   for (std::vector< host_t >::iterator i = publishers.begin(); 
         i != publishers.end(); ++i)
   {
+    ++children_;
+    if (!shards_.empty()) {
+      shards_[shard++ % shards_.size()].hosts.push_back(*i);
+      continue;
+    }
     boost::thread* pub_thread = new boost::thread(publisher_thread, z_ctx, *i);
     pub_threads.push_back(pub_thread);
   }
@@ -180,14 +245,14 @@ int Boxoffice::setupHeartbeaters()
   // standard variables
   zmqpp::message z_msg;
 
-  // opening heartbeater threads
-  if (F_MSG_DEBUG) printf("bo: opening %d heartbeater threads\n", (int)publishers.size());
-  for (std::vector< host_t >::iterator i = publishers.begin(); 
-        i != publishers.end(); ++i)
-  {
-    boost::thread* hb_thread = new boost::thread(heartbeater_thread, z_ctx, fsm::status_100);
-    hb_threads.push_back(hb_thread);
-  }
+  // opening the heartbeater thread; there is one for all publishers, 
+  // it hands every heartbeat to each of them, and the "bo_hb" channel 
+  // takes a single consumer
+  if ( publishers.empty() ) return 0;
+  if (F_MSG_DEBUG) printf("bo: opening heartbeater thread\n");
+  ++children_;
+  boost::thread* hb_thread = new boost::thread(heartbeater_thread, z_ctx, fsm::status_100);
+  hb_threads.push_back(hb_thread);
   if (F_MSG_DEBUG) printf("bo: opened %d heartbeater threads\n", (int)hb_threads.size());
 
   return 0;
@@ -198,12 +263,15 @@ int Boxoffice::setupDispatchers()
   // standard variables
   zmqpp::message z_msg;
 
-  // opening dispatcher threads
-  if (F_MSG_DEBUG) printf("bo: opening %d dispatcher threads\n", (int)publishers.size());
-  for (std::vector< host_t >::iterator i = publishers.begin(); 
-        i != publishers.end(); ++i)
+  // opening dispatcher threads, one for every box, so the transfers of 
+  // different boxes do not wait for each other
+  if ( publishers.empty() ) return 0;
+  if (F_MSG_DEBUG) printf("bo: opening %d dispatcher threads\n", (int)boxes.size());
+  for (session_map::iterator i = sessions_.begin(); i != sessions_.end(); ++i)
   {
-    boost::thread* disp_thread = new boost::thread(dispatcher_thread, z_ctx, fsm::status_100);
+    ++children_;
+    boost::thread* disp_thread = new boost::thread(dispatcher_thread, z_ctx, fsm::status_100,
+                                                   i->front()->box_hash->getBytes());
     disp_threads.push_back(disp_thread);
   }
   if (F_MSG_DEBUG) printf("bo: opened %d dispatcher threads\n", (int)disp_threads.size());
@@ -215,9 +283,15 @@ int Boxoffice::setupSubscribers()
 {
   // opening subscriber threads
   if (F_MSG_DEBUG) printf("bo: opening %d subscriber threads\n", (int)subscribers.size());
+  size_t shard = 0;
   for (node_map::iterator i = subscribers.begin(); 
         i != subscribers.end(); ++i)
   {
+    ++children_;
+    if (!shards_.empty()) {
+      shards_[shard++ % shards_.size()].nodes.push_back(i->second);
+      continue;
+    }
     boost::thread* sub_thread = new boost::thread(subscriber_thread, 
                                                   z_ctx, 
                                                   i->second);
@@ -228,28 +302,44 @@ int Boxoffice::setupSubscribers()
   return 0;
 }
 
+/**
+ * \fn Boxoffice::setupReactors
+ *
+ * Starts the threads shared by publishers, subscribers and boxes, if 
+ * configured. Heartbeaters and dispatchers wait out their deadlines 
+ * and keep threads of their own. 
+ */
+int Boxoffice::setupReactors()
+{
+  if (F_MSG_DEBUG) printf("bo: opening %d reactor threads\n", (int)shards_.size());
+  for (std::vector<reactor_shard_t>::iterator i = shards_.begin();
+       i != shards_.end(); ++i)
+  {
+    boost::thread* shard_thread = new boost::thread(reactor_thread, z_ctx, *i);
+    shard_threads.push_back(shard_thread);
+  }
+
+  return 0;
+}
+
 int Boxoffice::checkChildren() {
   // standard variables
   zmqpp::message z_msg;
-  int msg_type, msg_signal;
-  std::stringstream* sstream;
 
   // wait for heartbeat
-  int heartbeats = sub_threads.size()
-                 + pub_threads.size()
-                 + hb_threads.size()
-                 + disp_threads.size()
-                 + box_threads.size();
+  int heartbeats = children_;
+  Reactor reactor;
+  reactor.add(*z_broadcast);
+  reactor.add(*z_router);
   for (int i = 0; i < heartbeats; ++i)
   {
-    sstream = new std::stringstream();
-    s_recv(*z_router, *z_broadcast, *sstream);
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type != F_SIGTYPE_LIFE || msg_signal != F_SIGLIFE_ALIVE ) return 1;
-    delete sstream;
+    reactor.receive(z_msg);
+    FrameView frame = s_frame(z_msg);
+    if ( !frame.valid() || frame.type() != F_SIGTYPE_LIFE
+      || frame.status() != F_SIGLIFE_ALIVE ) return 1;
   }
   if (F_MSG_DEBUG) printf("bo: all subscribers, publishers, heartbeaters, dispatchers and boxes connected\n");
-  if (F_MSG_DEBUG) printf("bo: counted %d threads\n", heartbeats);
+  if (F_MSG_DEBUG) printf("bo: counted %d transmitters\n", heartbeats);
 
   return 0;
 }
@@ -257,24 +347,21 @@ int Boxoffice::checkChildren() {
 int Boxoffice::closeConnections()
 {
   // standard variables
-  int msg_type, msg_signal;
-  std::stringstream* sstream;
+  zmqpp::message z_msg;
   int return_value = 0;
 
   // wait for exit/interrupt signal
-  int heartbeats = sub_threads.size()
-                 + pub_threads.size()
-                 + hb_threads.size()
-                 + disp_threads.size()
-                 + box_threads.size();
+  int heartbeats = children_;
+  Reactor reactor;
+  reactor.add(*z_broadcast);
+  reactor.add(*z_router);
   for (int i = 0; i < heartbeats; ++i)
   {
-    sstream = new std::stringstream();
-    s_recv(*z_router, *z_broadcast, *sstream);
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type != F_SIGTYPE_LIFE || (   msg_signal != F_SIGLIFE_EXIT
-                                         && msg_signal != F_SIGLIFE_INTERRUPT ) ) return_value = 1;
-    delete sstream;
+    reactor.receive(z_msg);
+    FrameView frame = s_frame(z_msg);
+    if ( !frame.valid() || frame.type() != F_SIGTYPE_LIFE
+      || (   frame.status() != F_SIGLIFE_EXIT
+          && frame.status() != F_SIGLIFE_INTERRUPT ) ) return_value = 1;
   }
   if (F_MSG_DEBUG) printf("bo: all subscribers, publishers, heartbeaters, dispatchers and boxes exited\n");
 
@@ -298,20 +385,19 @@ int Boxoffice::closeConnections()
   for (std::vector<boost::thread*>::iterator i = box_threads.begin(); i != box_threads.end(); ++i)
     (*i)->join();
 
+  for (std::vector<boost::thread*>::iterator i = shard_threads.begin(); i != shard_threads.end(); ++i)
+    (*i)->join();
+
   if ( z_router != nullptr )
     z_router->close();
 
   z_bo_pub->close();
-  z_bo_hb->close();
-  z_bo_disp->close();
+
+  SyncQueue::getInstance()->flush();
 
   // sending exit signal to the main thread...
   if (F_MSG_DEBUG) printf("bo: sending exit signal...\n");
-  std::stringstream message;
-  message << F_SIGTYPE_LIFE << " " << F_SIGLIFE_EXIT;
-  zmqpp::message z_msg;
-  z_msg << message.str();
-  z_bo_main->send(z_msg);
+  s_send(*z_bo_main, Frame(F_SIGTYPE_LIFE, F_SIGLIFE_EXIT));
   // ...and exiting
   z_bo_main->close();
 
@@ -322,72 +408,114 @@ int Boxoffice::closeConnections()
 
 int Boxoffice::runRouter()
 { 
-  // standard variables
-  zmqpp::message z_msg;
-  int msg_type, msg_signal;
-  std::stringstream* sstream;
-
-  if (F_MSG_DEBUG) printf("bo: waiting for input from subscribers and watchers\n");
-  while(true)
-  {
-    // waiting for subscriber or inotify input
-    sstream = new std::stringstream();
-    s_recv(*z_router, *z_bo_main, *sstream);
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type == F_SIGTYPE_LIFE    && msg_signal == F_SIGLIFE_INTERRUPT ) 
-    {
-      delete sstream;
-      break;
-    }
+  int ret_val = 0;
+  // waiting for subscriber or inotify input
+  std::function<bool(const FrameView&)> route = [&](const FrameView& frame) {
+    if ( !frame.valid() ) return true;
+    if ( frame.type() == F_SIGTYPE_LIFE && frame.status() == F_SIGLIFE_INTERRUPT ) return false;
 
-    int ret_val = processEvent((fsm::status_t)msg_signal, sstream);
+    ret_val = processEvent((fsm::status_t)frame.status(), frame);
 
-    delete sstream;
+    // received files are synced in groups
+    SyncQueue::getInstance()->flushIfDue();
 
-    if (ret_val != 0) return ret_val;
-  }
+    return ret_val == 0;
+  };
 
-  return 0;
+  if (F_MSG_DEBUG) printf("bo: waiting for input from subscribers and watchers\n");
+  Reactor::message_handler_t route_message = [&](zmqpp::message& z_msg) {
+    return route(s_frame(z_msg));
+  };
+  Reactor::frame_handler_t route_frame = [&](Frame& frame) {
+    return route(FrameView(frame.data(), frame.size()));
+  };
+  // whole files are hashed and verified aside, see ContentHasher
+  hasher_.start();
+  Reactor::fd_handler_t take_hashes = [&]() {
+    ret_val = takeContentHashes();
+    return ret_val == 0;
+  };
+  Reactor reactor;
+  reactor.add(*z_bo_main, route_message);
+  reactor.add(*z_router, route_message);
+  for (std::vector<Box*>::iterator i = boxes.begin(); i != boxes.end(); ++i)
+    reactor.add(*(*i)->getChannel(), route_frame);
+  reactor.add(hasher_.fd(), take_hashes);
+  reactor.run();
+
+  // unfinished verifications keep their journals for the next start
+  hasher_.stop();
+  verifying_.clear();
+
+  return ret_val;
 }
 
+/**
+ * \fn Boxoffice::processEvent
+ *
+ * Every lane of a box runs an FSM of its own, a frame goes to the 
+ * session of the box and lane it is tagged with; local changes of a box 
+ * are given to a lane by pickSession. Idle heartbeats belong to no box 
+ * and go to all sessions; frames of boxes we do not have are dropped. 
+ */
 int Boxoffice::processEvent(fsm::status_t status, 
-                            std::stringstream* sstream) {
+                            const FrameView& frame) {
+  // every heartbeat of another node tells of its clock, whatever the 
+  // sessions make of it
+  if ( frame.type() == F_SIGTYPE_PUB
+    && fsm::get_event_by_status_code(status) == fsm::received_heartbeat_event )
+    updateTimestamp(frame);
+
+  box_session_t* session;
+  if ( frame.type() == F_SIGTYPE_INOTIFY ) {
+    msg::InotifyEvent inotify_event;
+    if (!inotify_event.decode(frame)) return 0;
+    session = pickSession(frame.box(),
+                          std::string(inotify_event.path, inotify_event.path_length));
+  } else {
+    session = findSession(frame.box(), frame.lane());
+  }
+  if ( session != nullptr ) return processEvent(*session, status, frame);
+  if ( status != fsm::status_100 ) return 0;
+
+  int ret_val = 0;
+  for (session_map::iterator i = sessions_.begin(); i != sessions_.end(); ++i)
+    for (std::vector<box_session_t*>::iterator j = i->begin();
+         j != i->end() && ret_val == 0; ++j)
+      ret_val = processEvent(**j, status, frame);
+  return ret_val;
+}
+
+int Boxoffice::processEvent(box_session_t& session,
+                            fsm::status_t status, 
+                            const FrameView& frame) {
   fsm::event_t event = fsm::get_event_by_status_code(status);
 
   if (F_MSG_DEBUG) printf("bo: checking event with state %d, event %d and status %d\n", 
-    state_, event, status);
-  if ( fsm::check_event(state_, event, status) ) {
+    session.state, event, status);
+  if ( fsm::check_event(session.state, event, status) ) {
 
     // RECEIVED_HEARTBEAT_EVENT
     if ( event == fsm::received_heartbeat_event ) {
-      // Synchronize the node's local time
-      updateTimestamp(sstream);
-
       switch ( status ) {
         // STATUS_100
         // if the received status was simply 100, do nothing...
         case fsm::status_100: {
-          stop_sync_timeout_received_ = false;
+          session.stop_sync_timeout_received = false;
           break;
         }
 
         // STATUS_121
         // waiting for all nodes to reply, then manually change the status
         case fsm::status_121: {
-          subscribers[current_node_hash_].replied = true;
+          session.replied.insert(current_node_index_);
 
-          node_map::iterator iter;
-          for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-            if ( iter->second.replied == false ) break;
-          }
-          if ( iter == subscribers.end() ) {
-            for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
-            }
+          if ( session.replied.size() == subscribers.size() ) {
+            session.replied.clear();
             status = fsm::status_122;
-            file_metadata_written_ = false;
+            session.file_metadata_written = false;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -395,19 +523,13 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_161
         // waiting for all nodes to reply, then manually change the status
         case fsm::status_161: {
-          subscribers[current_node_hash_].replied = true;
+          session.replied.insert(current_node_index_);
 
-          node_map::iterator iter;
-          for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-            if ( iter->second.replied == false ) break;
-          }
-          if ( iter == subscribers.end() ) {
-            for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
-            }
+          if ( session.replied.size() == subscribers.size() ) {
+            session.replied.clear();
             status = fsm::status_162;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -415,19 +537,13 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_165
         // waiting for all nodes to reply, then manually change the status
         case fsm::status_165: {
-          subscribers[current_node_hash_].replied = true;
+          session.replied.insert(current_node_index_);
 
-          node_map::iterator iter;
-          for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-            if ( iter->second.replied == false ) break;
-          }
-          if ( iter == subscribers.end() ) {
-            for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
-            }
+          if ( session.replied.size() == subscribers.size() ) {
+            session.replied.clear();
             status = fsm::status_166;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -436,19 +552,24 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_140
         // waiting for all nodes to reply, then manually change the status to 150
         case fsm::status_140: {
-          subscribers[current_node_hash_].replied = true;
-
-          node_map::iterator iter;
-          for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-            if ( iter->second.replied == false ) break;
-          }
-          if ( iter == subscribers.end() ) {
-            for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
+          session.replied.insert(current_node_index_);
+          // a node could not resolve all chunk references
+          msg::ResendRequest request;
+          if ( msg::decode<fsm::status_140>(frame, request)
+            && request.missing ) session.resend_current = true;
+
+          if ( session.replied.size() == subscribers.size() ) {
+            session.replied.clear();
+            if ( session.resend_current && session.sending_file != nullptr
+              && session.sending_resends < F_MAXIMUM_RESENDS ) {
+              // announced again, the nodes then ask for what they miss
+              ++session.sending_resends;
+              session.file_list_data.push_front(session.sending_file);
             }
+            session.resend_current = false;
             status = fsm::status_142;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -456,23 +577,17 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_141
         // waiting for all nodes to reply, then manually change the status
         case fsm::status_141: {
-          subscribers[current_node_hash_].replied = true;
+          session.replied.insert(current_node_index_);
 
-          node_map::iterator iter;
-          for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-            if ( iter->second.replied == false ) break;
-          }
-          if ( iter == subscribers.end() ) {
-            for (iter = subscribers.begin(); iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
-            }
-            if (file_list_metadata_.size() > 0) {
+          if ( session.replied.size() == subscribers.size() ) {
+            session.replied.clear();
+            if (session.file_list_metadata.size() > 0) {
               // have more metadata only files
               status = fsm::status_174;
-            } else if (file_list_data_.size() > 1) {
+            } else if (session.file_list_data.size() > 1) {
               // have multiple files
               status = fsm::status_178;
-            } else if (file_list_data_.size() > 0) {
+            } else if (session.file_list_data.size() > 0) {
               // have one file
               status = fsm::status_177;
             } else {
@@ -480,7 +595,7 @@ int Boxoffice::processEvent(fsm::status_t status,
               status = fsm::status_172;
             }
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -490,142 +605,137 @@ int Boxoffice::processEvent(fsm::status_t status,
         case fsm::status_120:
         case fsm::status_124:
           {
-            notified_dispatch_ = false;
+            session.notified_dispatch = false;
             break;
           }
         // STATUS_132
         case fsm::status_132:
           {
-            for (node_map::iterator iter = subscribers.begin();
-                 iter != subscribers.end(); ++iter) {
-              iter->second.replied = false;
-            }
+            session.replied.clear();
             break;
           }
 
         // STATUS_130
         // waiting for file metadata
         case fsm::status_130: {
-          if ( state_ == fsm::promoting_new_file_metadata_state
-                && !notified_dispatch_ ) {
-            sstream->seekg(1, std::ios_base::cur);
-            char box_hash_s[F_GENERIC_HASH_LEN];
-            sstream->read(box_hash_s, F_GENERIC_HASH_LEN);
-            unsigned char box_hash[F_GENERIC_HASH_LEN];
-            std::memcpy(box_hash, box_hash_s, F_GENERIC_HASH_LEN);
-
-            Hash* hash = new Hash(box_hash);
-            Box* box = boxes[hash];
+          if ( session.state == fsm::promoting_new_file_metadata_state
+                && !session.notified_dispatch ) {
+            msg::FileAnnouncement announcement;
+            if (!msg::decode<fsm::status_130>(frame, announcement)) break;
+            const unsigned char* box_hash = session.box_hash->getBytes();
+            unsigned char content_hash[F_GENERIC_HASH_LEN];
+            std::memcpy(content_hash, announcement.content_hash, F_GENERIC_HASH_LEN);
+
+            Box* box = session.box;
+            Hash* hash = session.box_hash;
             File* new_file = new File(box->getBaseDir(), hash);
-            *sstream >> *new_file;
-            if (!file_metadata_written_) {
-              new_file->storeMetadata();
-              new_file->resize();
-              file_metadata_written_ = true;
+            new_file->setStaging(staging_);
+            MemoryInputStream record(announcement.record, announcement.record_length);
+            record >> *new_file;
+            // the version before may still be being verified
+            awaitVerification(hash, new_file->getPath());
+            new_file->create();
+            new_file->setHoles(announcement.holes);
+
+            if (!session.file_metadata_written) {
+              session.receiving_incomplete = false;
+              session.receiving_holes = announcement.holes;
+
+              // if we still have the version we last synced, the sender 
+              // can send a delta against it
+              session.receiving_delta_base.clear();
+              struct stat st;
+              boost::filesystem::path target =
+                boost::filesystem::path(box->getBaseDir()) / new_file->getPath();
+              Signature signature;
+              if ( ::stat(target.c_str(), &st) == 0 && S_ISREG(st.st_mode)
+                && signature.load(Signature::getSignaturePath(journal_dir_, box_hash,
+                                                              new_file->getPath()))
+                && signature.matches(st.st_size, st.st_mtime) ) {
+                session.receiving_delta_base.assign(
+                  reinterpret_cast<const char*>(signature.getContentHash()), F_GENERIC_HASH_LEN);
+              }
+
+              // reserve the space now, mode and mtime follow once all
+              // data has been stored; a delta applied in place still
+              // needs the old data behind the new end of the file
+              if ( staging_ || session.receiving_delta_base.empty()
+                || new_file->getSize() >= static_cast<uint64_t>(st.st_size) )
+                new_file->resize();
+              session.file_metadata_written = true;
             }
-            std::memcpy(current_box_, box_hash, F_GENERIC_HASH_LEN);
-            std::stringstream cf;
-            cf << *new_file;
-            current_file_.str("");
-            current_file_.clear();
-            current_file_ << cf.str().substr(32);
+            session.current_file.str("");
+            session.current_file.clear();
+            session.current_file << *new_file;
             delete new_file;
-            notified_dispatch_ = false;
-
-            char* timing_offset_c = new char[8];
-            sstream->read(timing_offset_c, 8);
-
-            std::stringstream* message = new std::stringstream();
-            *message << F_SIGTYPE_FSM  << " "
-                     << fsm::status_130 << " ";
-            message->write(timing_offset_c, 8);
-            zmqpp::message z_msg;
-            z_msg << message->str();
-            z_bo_disp->send(z_msg);
-            notified_dispatch_ = true;
+            session.notified_dispatch = false;
+
+            // look up what we already have of this file and tell the
+            // sender which ranges are still missing
+            if (session.receiving_journal == nullptr) {
+              File* journal_file = new File(box->getBaseDir(), hash);
+              journal_file->setStaging(staging_);
+              session.current_file.seekg(0, std::ios_base::beg);
+              session.current_file >> *journal_file;
+              session.receiving_journal = new TransferJournal(journal_dir_, box_hash,
+                                                              journal_file->getPath());
+              session.receiving_resumed =
+                session.receiving_journal->open(journal_file->getSize(),
+                                                journal_file->getMtime(),
+                                                content_hash);
+              delete journal_file;
+              updateHeartbeat(session, fsm::status_131, session.state);
+            }
+
+            Frame message(F_SIGTYPE_FSM, fsm::status_130);
+            message.setTimestamp(clock_.toLocalTime(announcement.deadline))
+                   .setBox(session.box_hash->getBytes())
+                   .setLane(session.lane);
+            s_send(*session.disp_channel, message, true);
+            session.notified_dispatch = true;
           }
 
           break;
         }
+        // STATUS_131
+        // collecting the ranges every node is missing of the current file
+        case fsm::status_131: {
+          if ( session.state == fsm::sending_new_file_metadata_state
+            || session.state == fsm::sending_new_file_metadata_with_more_state ) {
+            collectResumeRanges(session, frame);
+          }
+          break;
+        }
         // STATUS_160
         // acknowledging new file metadata
         case fsm::status_160: {
-          file_metadata_written_ = false;
+          session.file_metadata_written = false;
           break;
         }
-        // STATUS_170
-        // receiving file metadata
-        case fsm::status_170: {
-          if (state_ == fsm::receiving_file_metadata_change_state) {
-            sstream->seekg(1, std::ios_base::cur);
-            char box_hash_s[F_GENERIC_HASH_LEN];
-            sstream->read(box_hash_s, F_GENERIC_HASH_LEN);
-            unsigned char box_hash[F_GENERIC_HASH_LEN];
-            std::memcpy(box_hash, box_hash_s, F_GENERIC_HASH_LEN);
-
-            Hash* hash = new Hash(box_hash);
-            Box* box = boxes[hash];
-            File* new_file = new File(box->getBaseDir(), hash);
-            *sstream >> *new_file;
-
-            if (!new_file->isToBeDeleted() && !file_metadata_written_) {
-              if (new_file->exists()) {
-                new_file->resize();
-              } else {
-                new_file->create();
-              }
-              new_file->storeMetadata();
-              file_metadata_written_ = true;
-            }
-            delete new_file;
-
-            status = fsm::status_173;
-            file_metadata_written_ = false;
-            event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
-          }
-
-          break;
-        }
-        // STATUS_174
-        // receiving file metadata with additional files to come
+        // STATUS_170 || STATUS_174
+        // receiving a batch of metadata changes, with more to come for 174
+        case fsm::status_170:
         case fsm::status_174: {
-          if (state_ == fsm::receiving_file_metadata_change_with_more_state) {
-            sstream->seekg(1, std::ios_base::cur);
-            char box_hash_s[F_GENERIC_HASH_LEN];
-            sstream->read(box_hash_s, F_GENERIC_HASH_LEN);
-            unsigned char box_hash[F_GENERIC_HASH_LEN];
-            std::memcpy(box_hash, box_hash_s, F_GENERIC_HASH_LEN);
-
-            Hash* hash = new Hash(box_hash);
-            Box* box = boxes[hash];
-            File* new_file = new File(box->getBaseDir(), hash);
-            *sstream >> *new_file;
-
-            if (!new_file->isToBeDeleted() && !file_metadata_written_) {
-              if (new_file->exists()) {
-                new_file->resize();
-              } else {
-                new_file->create();
-              }
-              new_file->storeMetadata();
-              // \TODO in status_174 the sender sends the metadata
-              //       of all files without changing the status, this 
-              //       isn't handled yet
-              file_metadata_written_ = true;
+          if ( (status == fsm::status_170
+             && session.state == fsm::receiving_file_metadata_change_state)
+            || (status == fsm::status_174
+             && session.state == fsm::receiving_file_metadata_change_with_more_state) ) {
+            msg::MetadataChange change;
+            if ( status == fsm::status_170 ? !msg::decode<fsm::status_170>(frame, change)
+                                           : !msg::decode<fsm::status_174>(frame, change) ) break;
+
+            // the heartbeat repeats until we replied, the batch is 
+            // applied only once
+            if (!session.file_metadata_written) {
+              if (!applyMetadataChanges(session, change)) break;
+              session.file_metadata_written = true;
             }
-            std::memcpy(current_box_, box_hash, F_GENERIC_HASH_LEN);
-            std::stringstream cf;
-            cf << *new_file;
-            current_file_.str("");
-            current_file_.clear();
-            current_file_ << cf.str().substr(32);
-            delete new_file;
-            notified_dispatch_ = false;
+            session.notified_dispatch = false;
 
+            if (status == fsm::status_170) session.file_metadata_written = false;
             status = fsm::status_173;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
+            if ( !check_event(session.state, event, status) ) return 1;
           }
 
           break;
@@ -634,12 +744,12 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_150
         // when receiving 150 in ready_state_, return to normal heartbeat
         case fsm::status_150: {
-          if ( state_ == fsm::ready_state ) {
+          if ( session.state == fsm::ready_state ) {
             status = fsm::status_100;
             event = fsm::get_event_by_status_code(status);
-            if ( !check_event(state_, event, status) ) return 1;
-            fsm::action_t action = fsm::get_action(state_, event, status);
-            performAction(event, action, status, state_);
+            if ( !check_event(session.state, event, status) ) return 1;
+            fsm::action_t action = fsm::get_action(session.state, event, status);
+            performAction(session, event, action, status, session.state);
           }
 
           break;
@@ -647,18 +757,15 @@ int Boxoffice::processEvent(fsm::status_t status,
         // STATUS_155
         // when receiving 155 in ready_state_, return to normal heartbeat
         case fsm::status_155: {
-          if (!stop_sync_timeout_received_) {
-            std::stringstream* message = new std::stringstream();
-            *message << F_SIGTYPE_FSM  << " "
-                     << fsm::status_155 << " ";
-            sstream->seekg(1, std::ios_base::cur);
-            char* timing_offset_c = new char[8];
-            sstream->read(timing_offset_c, 8);
-            message->write(timing_offset_c, 8);
-            zmqpp::message z_msg;
-            z_msg << message->str();
-            z_bo_disp->send(z_msg);
-            stop_sync_timeout_received_ = true;
+          if (!session.stop_sync_timeout_received) {
+            msg::StopDeadline stop;
+            if (!msg::decode<fsm::status_155>(frame, stop)) break;
+            Frame message(F_SIGTYPE_FSM, fsm::status_155);
+            message.setTimestamp(clock_.toLocalTime(stop.deadline))
+                   .setBox(session.box_hash->getBytes())
+                   .setLane(session.lane);
+            s_send(*session.disp_channel, message, true);
+            session.stop_sync_timeout_received = true;
             break;
           }
         }
@@ -669,120 +776,69 @@ int Boxoffice::processEvent(fsm::status_t status,
     }
 
 
+    const bool local_change = event == fsm::new_local_file_event
+                           || event == fsm::new_local_file_with_more_event
+                           || event == fsm::local_file_metadata_change_event
+                           || event == fsm::local_file_metadata_change_with_more_event;
+    // the file to be announced next may still be being hashed
+    if ( !local_change && awaitContentHash(session, event, status) ) return 0;
+
     // ALL_NODES_REPLIED
     // ALL_NODES_HAVE_ALL_METADATA_CHANGES_WITH_MORE && STATUS177
     // The next state requires the dispatcher to fire after
     // a calculated offset
-    if ( (  event == fsm::all_nodes_replied_event
-        && status == fsm::status_122 )
-      || (  event == fsm::all_nodes_have_all_metadata_changes_with_more_event
-        && status == fsm::status_177 ) ) {
-      // calculating offset, store it and send it to dispatch
-      std::stringstream message;
-      message << F_SIGTYPE_FSM << " "
-              << status         << " ";
-
-      // jump back to the beginning of the stream to
-      // re-read the node_hash
-      sstream->seekg(5, std::ios_base::beg);
-      char node_hash_s[F_GENERIC_HASH_LEN];
-      sstream->read(node_hash_s, F_GENERIC_HASH_LEN);
-      unsigned char node_hash[F_GENERIC_HASH_LEN];
-      std::memcpy(node_hash, node_hash_s, F_GENERIC_HASH_LEN);
-      Hash* hash = new Hash(node_hash);
-
-      uint64_t timestamp =
-        std::chrono::duration_cast< std::chrono::milliseconds >(
-          std::chrono::system_clock::now().time_since_epoch()
-        ).count();
-      uint32_t random_offset = randombytes_uniform(F_MAXIMUM_SEND_OFFSET-F_MINIMUM_SEND_OFFSET);
-      random_offset += F_MINIMUM_SEND_OFFSET;
-      current_timing_offset_ = timestamp
-                               + random_offset
-                               - subscribers[hash].offset; // \TODO this should be the average across all nodes
-      uint64_t timing_offset = htobe64(current_timing_offset_);
-      char* timing_offset_c = new char[8];
-      std::memcpy(timing_offset_c, &timing_offset, 8);
-      message.write(timing_offset_c, 8);
-
-      char* box_hash = new char[F_GENERIC_HASH_LEN];
-      std::memcpy(box_hash, current_box_, F_GENERIC_HASH_LEN);
-      message.write(box_hash, F_GENERIC_HASH_LEN);
-      Hash* box_hash_obj = new Hash(current_box_);
-      Box* box = boxes[box_hash_obj];
-      message << box->getBaseDir() << " ";
-      File* current_file = file_list_data_.front();
-      std::stringstream cf;
-      cf << *current_file;
-      message << cf.str().substr(32);
-
-      zmqpp::message z_msg;
-      z_msg << message.str();
-      z_bo_disp->send(z_msg);
-    }
+    dispatchFile(session, event, status);
 
     // NEW_LOCAL_FILE_EVENT || LOCAL_FILE_METADATA_CHANGE_EVENT
     // NEW_LOCAL_FILE_EVENT_WITH_MORE || LOCAL_FILE_METADATA_CHANGE_EVENT_WITH_MORE
-    // if the event was new_local_file_event, add the path of the file to the queue;
-    // if the state was announcing_new_file_state, we need to check if the reported 
-    // file is the same as the last one, otherwise we would push the same file
-    // twice; TODO if a file was created and immediately deleted, that file should 
-    // be removed and - if necessary - the state should be reverted
-    if ( event == fsm::new_local_file_event
-      || event == fsm::new_local_file_with_more_event
-      || event == fsm::local_file_metadata_change_event
-      || event == fsm::local_file_metadata_change_with_more_event ) {
-      int inotify_mask;
-      *sstream >> inotify_mask;
-
-      char box_hash_s[F_GENERIC_HASH_LEN];
-      sstream->read(box_hash_s, F_GENERIC_HASH_LEN);
-      unsigned char box_hash[F_GENERIC_HASH_LEN];
-      std::memcpy(box_hash, box_hash_s, F_GENERIC_HASH_LEN);
-      std::memcpy(current_box_, box_hash, F_GENERIC_HASH_LEN);
-
-      std::string path;
-      *sstream >> path;
-
-      if ( path.length() > 128 ) {
+    // if the event was new_local_file_event, add the file to the data queue, 
+    // else to the metadata queue; a path that is queued already is merged 
+    // with the change before, see queueLocalChange
+    if ( local_change ) {
+      msg::InotifyEvent inotify_event;
+      if (!inotify_event.decode(frame)) return 0;
+      uint32_t inotify_mask = inotify_event.mask;
+      std::string path(inotify_event.path, inotify_event.path_length);
+
+      if ( path.length() > F_MAXIMUM_PATH_LENGTH ) {
         std::cerr << "[E]: filepath is too long, flocksy only supports "
-                  << "files up to 128 characters (including subdirectories, "
-                  << "excluding the base path)" << std::endl;
+                  << "files up to " << F_MAXIMUM_PATH_LENGTH << " characters "
+                  << "(including subdirectories, excluding the base path)" << std::endl;
         return 1;
       }
 
-      std::deque< File* >* file_list;
+      PendingChanges* file_list;
       if ( event == fsm::new_local_file_event
         || event == fsm::new_local_file_with_more_event ) {
-        file_list = &file_list_data_;
+        file_list = &session.file_list_data;
       } else {
-        file_list = &file_list_metadata_;
+        file_list = &session.file_list_metadata;
       } 
 
-      Hash* hash = new Hash(box_hash);
-      Box* box = boxes[hash];
+      Box* box = session.box;
+      Hash* hash = session.box_hash;
       File* new_file;
       if ((inotify_mask & IN_DELETE) == IN_DELETE) {
         new_file = new File(box->getBaseDir(), hash, path, false, true);
       } else {
         new_file = new File(box->getBaseDir(), hash, path);
       }
-      if ( state_ == fsm::announcing_new_file_state ) {
-        std::deque<File*>::iterator iter;
-        iter = std::find(file_list->begin(), file_list->end(), new_file);
-        if ( iter != file_list->end() ) {
-          file_list->push_back(new_file);
-        } else {
-          status = fsm::status_301;
-          event = fsm::get_event_by_status_code(status);
-        }
-      } else {
-        file_list->push_back(new_file);
-      }
-      for (node_map::iterator iter = subscribers.begin();
-           iter != subscribers.end(); ++iter) {
-        iter->second.replied = false;
+      // a record too long for a heartbeat could never be announced
+      std::stringstream record;
+      record << *new_file;
+      if ( record.str().size() > msg::FileAnnouncement::maximum_record_length ) {
+        std::cerr << "[E]: filepath " << path << " is too long to be announced, "
+                  << "ignoring the change" << std::endl;
+        delete new_file;
+        return 0;
       }
+      const bool merged = file_list->has(path);
+      queueLocalChange(session, *file_list, new_file);
+      requestContentHash(session);
+      // a change merged into one already queued leaves the FSM as it is
+      if (merged) return 0;
+      session.replied.clear();
+      if ( awaitContentHash(session, event, status) ) return 0;
     }
 
 
@@ -790,54 +846,97 @@ int Boxoffice::processEvent(fsm::status_t status,
     // read the file data and store it
     if ( event == fsm::received_file_data_event ) {
       if (F_MSG_DEBUG) printf("bo: receiving file data...\n");
-      Hash* box_hash = new Hash(current_box_);
-      Box* box = boxes[box_hash];
-      File* file = new File(box->getBaseDir(), box_hash);
-      current_file_ >> *file;
-
-      sstream->seekg(F_GENERIC_HASH_LEN, std::ios_base::cur);
-      char* offset_c = new char[8];
-      sstream->read(offset_c, 8);
-      uint64_t offset_be;
-      std::memcpy(&offset_be, offset_c, 8);
-      uint64_t offset = be64toh(offset_be);
-
-      char* data_size_c = new char[8];
-      sstream->read(data_size_c, 8);
-      uint64_t data_size_be;
-      std::memcpy(&data_size_be, data_size_c, 8);
-      uint64_t data_size = be64toh(data_size_be);
-
-      char* more_c = new char[1];
-      sstream->read(more_c, 1);
-      int8_t more_i;
-      std::memcpy(&more_i, more_c, 1);
-      bool more = static_cast<bool>(more_i);
-
-      char* contents = new char[data_size];
-      sstream->read(contents, data_size);
-      file->storeFileData(contents, data_size, offset);
-      delete contents;
-      delete file;
+      // the file stays open for the whole transfer
+      if (session.receiving_file == nullptr) {
+        session.receiving_file = new File(session.box->getBaseDir(), session.box_hash);
+        session.receiving_file->setStaging(staging_);
+        session.current_file.clear();
+        session.current_file.seekg(0, std::ios_base::beg);
+        session.current_file >> *session.receiving_file;
+        session.receiving_file->create();
+        session.receiving_file->openFile();
+      }
+
+      uint64_t offset = frame.offset();
+      uint64_t data_size = frame.length();
+      bool more = frame.more();
+      uint8_t op = frame.op();
+
+      bool stored = true;
+      if (op == DeltaInstruction::copy) {
+        // a block the receivers already have, somewhere in the old version
+        msg::CopySource copy;
+        stored = copy.decode(frame)
+              && session.receiving_file->copyFileData(copy.source, data_size, offset);
+      } else if (op == DeltaInstruction::references) {
+        // chunks we may already have, data_size is the number of references
+        stored = false;
+        msg::ChunkReference reference;
+        for (uint64_t i = 0; i < data_size && reference.decode(frame, i); ++i) {
+          Chunk chunk;
+          chunk.offset = reference.offset;
+          chunk.length = reference.length;
+          std::memcpy(chunk.hash, reference.hash, F_GENERIC_HASH_LEN);
+          // unresolved chunks stay missing in the journal
+          if ( session.receiving_file->storeChunk(chunk, reference.source)
+            && session.receiving_journal != nullptr )
+            session.receiving_journal->markRange(chunk.offset, chunk.length);
+        }
+      } else if (op == DeltaInstruction::hole) {
+        // a hole of a sparse file, data_size is its length
+        stored = session.receiving_file->punchHole(offset, data_size);
+      } else if (op == DeltaInstruction::compressed) {
+        // data_size is the unpacked length, which may span several packages
+        stored = data_size <= F_COMPRESSION_MAXIMUM_INPUT
+              && Compression::unpack(frame.payload(), frame.payloadSize(),
+                                     unpacked_.data(), data_size);
+        for (uint64_t written = 0; stored && written < data_size;
+             written += F_MAXIMUM_FILE_PACKAGE_SIZE) {
+          session.receiving_file->storeFileData(unpacked_.data() + written,
+                                                std::min<uint64_t>(data_size - written,
+                                                                   F_MAXIMUM_FILE_PACKAGE_SIZE),
+                                                offset + written);
+        }
+        if (!stored)
+          std::cerr << "[E] could not unpack data of " << session.receiving_file->getPath()
+                    << " at offset " << offset << std::endl;
+      } else {
+        if (data_size > frame.payloadSize())
+          data_size = frame.payloadSize();
+        session.receiving_file->storeFileData(frame.payload(), data_size, offset);
+      }
+      if (session.receiving_journal != nullptr && stored)
+        session.receiving_journal->markRange(offset, data_size);
+
+      if (!more) {
+        if (session.receiving_journal == nullptr) {
+          session.receiving_file->finishFileData();
+        } else if (!session.receiving_journal->complete()) {
+          // the missing ranges are requested when the sender announces
+          // the file again
+          if (F_MSG_DEBUG) printf("bo: %lu chunks still missing, keeping journal\n",
+            session.receiving_journal->getMissingChunkCount());
+          session.receiving_incomplete = true;
+        } else {
+          verifyReceivedFile(session);
+        }
+        delete session.receiving_journal;
+        session.receiving_journal = nullptr;
+        delete session.receiving_file;
+        session.receiving_file = nullptr;
+      }
 
       if (!more) {
         status = fsm::status_113;
         event = fsm::get_event_by_status_code(status);
-        if ( !check_event(state_, event, status) ) return 1;
+        if ( !check_event(session.state, event, status) ) return 1;
       }
     }
 
 
 
     // FSM CONTINUE
-    fsm::state_t new_state = fsm::get_new_state(state_, event, status);
-    if ( state_ != new_state ) {
-      fsm::action_t action = fsm::get_action(state_, event, status);
-      performAction(event, action, status, new_state);
-      if (F_MSG_DEBUG) printf("bo: updating self to state %d\n", 
-        fsm::get_new_state(state_, event, status));
-      state_ = new_state;
-    }
+    return changeState(session, event, status);
 
   } else {
     if (F_MSG_DEBUG) printf("bo: unhandled event, ignoring...\n");
@@ -846,15 +945,78 @@ int Boxoffice::processEvent(fsm::status_t status,
   return 0;
 }
 
-int Boxoffice::performAction(fsm::event_t const event, 
+/**
+ * \fn Boxoffice::dispatchFile
+ *
+ * Once all nodes replied to its announcement, the dispatcher is told 
+ * which file to send and when, after a calculated offset. 
+ */
+void Boxoffice::dispatchFile(box_session_t& session,
+                             fsm::event_t const event,
+                             fsm::status_t const status) {
+  if ( (  event == fsm::all_nodes_replied_event
+      && status == fsm::status_122 )
+    || (  event == fsm::all_nodes_have_all_metadata_changes_with_more_event
+      && status == fsm::status_177 ) ) {
+    // calculating offset, store it and send it to dispatch
+    uint64_t timestamp =
+      std::chrono::duration_cast< std::chrono::milliseconds >(
+        std::chrono::system_clock::now().time_since_epoch()
+      ).count();
+    session.current_timing_offset = timestamp
+                             + getDeadlineOffset(F_SEND_OFFSET_TICKS);
+    session.resume_ranges.clear();
+    session.resume_full = false;
+    session.resume_delta_base.clear();
+    session.resume_delta_in_place = false;
+
+    Box* box = session.box;
+    File* current_file = session.file_list_data.front();
+    std::stringstream cf;
+    cf << *current_file;
+    std::string box_dir = box->getBaseDir();
+    std::string record = cf.str();
+    msg::DispatchFile dispatch = { box_dir.data(), box_dir.size(),
+                                   record.data(), record.size() };
+
+    Frame message(F_SIGTYPE_FSM, status);
+    message.setTimestamp(session.current_timing_offset)
+           .setBox(session.box_hash->getBytes())
+           .setLane(session.lane);
+    dispatch.encode(message);
+    s_send(*session.disp_channel, message, true);
+  }
+}
+
+/**
+ * \fn Boxoffice::changeState
+ *
+ * Takes the transition of the FSM for the event and performs its action. 
+ */
+int Boxoffice::changeState(box_session_t& session,
+                           fsm::event_t const event,
+                           fsm::status_t const status) {
+  fsm::state_t new_state = fsm::get_new_state(session.state, event, status);
+  if ( session.state != new_state ) {
+    fsm::action_t action = fsm::get_action(session.state, event, status);
+    performAction(session, event, action, status, new_state);
+    if (F_MSG_DEBUG) printf("bo: updating self to state %d\n", new_state);
+    session.state = new_state;
+  }
+
+  return 0;
+}
+
+int Boxoffice::performAction(box_session_t& session,
+                             fsm::event_t const event, 
                              fsm::action_t const action, 
                              fsm::status_t const received_status,
                              fsm::state_t const new_state) {
 
   switch (action) {
     case fsm::send_heartbeat_action: {
-      fsm::status_t new_status = fsm::get_heartbeat_status(state_, event, received_status);
-      updateHeartbeat(new_status, new_state);
+      fsm::status_t new_status = fsm::get_heartbeat_status(session.state, event, received_status);
+      updateHeartbeat(session, new_status, new_state);
       break;
     }
     default:
@@ -865,73 +1027,169 @@ int Boxoffice::performAction(fsm::event_t const event,
   return 0;
 }
 
-int Boxoffice::updateHeartbeat(fsm::status_t const new_status,
+int Boxoffice::updateHeartbeat(box_session_t& session,
+                               fsm::status_t const new_status,
                                fsm::state_t const new_state) {
+  // the heartbeater falls back to idle heartbeats on its own
+  if ( new_status == fsm::status_100 && session.heartbeat_status == fsm::status_100 )
+    return 0;
+  session.heartbeat_status = new_status;
+
   if (F_MSG_DEBUG) printf("bo: changing status code to %d\n", new_status);
-  std::stringstream* message = new std::stringstream();
-  *message << F_SIGTYPE_FSM << " " << new_status << " ";
-  prepareHeartbeatMessage(message, new_state);
-  zmqpp::message z_msg;
-  z_msg << message->str();
-  z_bo_hb->send(z_msg);
-  delete message;
+  Frame message(F_SIGTYPE_FSM, new_status);
+  message.setBox(session.box_hash->getBytes())
+         .setLane(session.lane);
+  prepareHeartbeatMessage(session, message, new_state);
+  s_send(*bo_hb_channel, message, true);
 
   return 0;
 }
 
-void Boxoffice::prepareHeartbeatMessage(std::stringstream* message, 
+void Boxoffice::prepareHeartbeatMessage(box_session_t& session,
+                                        Frame& message, 
                                         fsm::state_t const new_state) {
-  *message << "";
-
   if (        new_state == fsm::sending_new_file_metadata_state
            || new_state == fsm::sending_new_file_metadata_with_more_state ) {
-    File* current_file = file_list_data_.front();
-    std::stringstream cf;
-    cf << *current_file;
-    current_file_.str("");
-    current_file_.clear();
-    current_file_ << cf.str().substr(32);
-    *message << *current_file;
-    file_list_data_.pop_front();
-    uint64_t timing_offset = htobe64(current_timing_offset_);
-    char* timing_offset_c = new char[8];
-    std::memcpy(timing_offset_c, &timing_offset, 8);
-    message->write(timing_offset_c, 8);
+    File* current_file = session.file_list_data.front();
+    session.current_file.str("");
+    session.current_file.clear();
+    session.current_file << *current_file;
+    session.file_list_data.pop_front();
+    // the next file is read ahead while this one is being sent
+    if (!session.file_list_data.empty()) {
+      session.file_list_data.front()->prefetch(F_PREFETCH_DEPTH * F_PREFETCH_BLOCK_SIZE);
+      session.file_list_data.front()->closeFile();
+      requestContentHash(session);
+    }
+    // a file sent before is not queued anymore by now, see queueLocalChange
+    if (current_file != session.sending_file) {
+      delete session.sending_file;
+      session.sending_resends = 0;
+    }
+    session.sending_file = current_file;
+    std::string record = session.current_file.str();
+    // hashed ahead, see awaitContentHash
+    if (current_file->getAnnouncedContentHash() == nullptr)
+      current_file->prepareAnnouncement(msg::FileAnnouncement::maximumHoles(record.size()));
+    msg::FileAnnouncement announcement;
+    // deadlines go out in flock time, see ClockSync
+    announcement.deadline = clock_.toFlockTime(session.current_timing_offset);
+    announcement.content_hash = current_file->getAnnouncedContentHash();
+    // receivers need not allocate the holes of sparse files; as many of 
+    // the largest ones as fit into the heartbeat are announced
+    announcement.holes = current_file->getAnnouncedHoles();
+    announcement.record = record.data();
+    announcement.record_length = record.size();
+    current_file->closeFile();
+    announcement.encode(message);
+  } else if ( new_state == fsm::promoting_new_file_metadata_state
+           && session.receiving_journal != nullptr ) {
+    msg::ResumeReply reply;
+    if (session.receiving_resumed) {
+      reply.tag = 'R';
+      reply.ranges = session.receiving_journal->getMissingRanges(F_MAXIMUM_RESUME_RANGES);
+    } else if (!session.receiving_delta_base.empty()) {
+      reply.tag = 'D';
+      reply.base = reinterpret_cast<const unsigned char*>(session.receiving_delta_base.data());
+      reply.in_place = !staging_;
+    } else {
+      reply.tag = 'F';
+    }
+    reply.encode(message);
+  } else if ( (new_state == fsm::broadcasting_all_received_state
+             || new_state == fsm::broadcasting_all_received_with_more_alpha_state
+             || new_state == fsm::broadcasting_all_received_with_more_beta_state)
+           && session.receiving_incomplete ) {
+    // ask the sender to announce the file again for the missing chunks
+    msg::ResendRequest request = { true };
+    request.encode(message);
   } else if ( new_state == fsm::sending_file_metadata_change_state
            || new_state == fsm::sending_file_metadata_change_with_more_state) {
-    File* current_file = file_list_metadata_.front();
-    std::stringstream cf;
-    cf << *current_file;
-    current_file_.str("");
-    current_file_.clear();
-    current_file_ << cf.str().substr(32);
-    *message << *current_file;
-    file_list_metadata_.pop_front();
-  } else if ( new_state == fsm::syncing_stop_state && !stop_sync_timeout_received_ ) {
+    // as many changes as fit into one heartbeat go out in one round, so 
+    // a batch is as long as any other heartbeat; every record fits on 
+    // its own, see the check when it is queued
+    std::string records;
+    PathCodec codec;
+    msg::MetadataChange change = { 0, nullptr, 0 };
+    while ( !session.file_list_metadata.empty()
+         && change.count < F_METADATA_BATCH_SIZE ) {
+      PathCodec next = codec;
+      std::stringstream record;
+      session.file_list_metadata.front()->serialize(record, next);
+      if ( records.size() + record.str().size()
+             > msg::MetadataChange::maximum_records_length ) break;
+      records += record.str();
+      codec = next;
+      ++change.count;
+      delete session.file_list_metadata.front();
+      session.file_list_metadata.pop_front();
+    }
+    change.records = records.data();
+    change.records_length = records.size();
+    change.encode(message);
+  } else if ( new_state == fsm::syncing_stop_state && !session.stop_sync_timeout_received ) {
     uint64_t timestamp =
       std::chrono::duration_cast< std::chrono::milliseconds >(
         std::chrono::system_clock::now().time_since_epoch()
       ).count();
-    uint32_t random_offset = randombytes_uniform(F_MAXIMUM_STOP_OFFSET-F_MINIMUM_STOP_OFFSET);
-    random_offset += F_MINIMUM_STOP_OFFSET;
-    current_timing_offset_ = timestamp
-                             + random_offset;
-    uint64_t timing_offset = htobe64(current_timing_offset_);
-
-    std::stringstream* disp_message = new std::stringstream();
-    *disp_message << F_SIGTYPE_FSM  << " "
-             << fsm::status_155 << " ";
-    char* timing_offset_c = new char[8];
-    std::memcpy(timing_offset_c, &timing_offset, 8);
-    disp_message->write(timing_offset_c, 8);
-    zmqpp::message z_msg;
-    z_msg << disp_message->str();
-    z_bo_disp->send(z_msg);
-
-    message->write(timing_offset_c, 8);
-
-    stop_sync_timeout_received_ = true;
+    session.current_timing_offset = timestamp
+                             + getDeadlineOffset(F_STOP_OFFSET_TICKS);
+
+    Frame disp_message(F_SIGTYPE_FSM, fsm::status_155);
+    disp_message.setTimestamp(session.current_timing_offset)
+                .setBox(session.box_hash->getBytes())
+                .setLane(session.lane);
+    s_send(*session.disp_channel, disp_message, true);
+
+    msg::StopDeadline stop = { clock_.toFlockTime(session.current_timing_offset) };
+    stop.encode(message);
+
+    session.stop_sync_timeout_received = true;
+  }
+}
+
+/**
+ * \fn Boxoffice::applyMetadataChanges
+ *
+ * All records of a batch are read before any of them is applied, so a 
+ * malformed batch changes nothing and is not acknowledged. Only the 
+ * size of existing files is set, their blocks are left to the data 
+ * transfers, so sparse files stay sparse. 
+ */
+bool Boxoffice::applyMetadataChanges(box_session_t& session,
+                                     const msg::MetadataChange& change) {
+  std::vector<File*> files;
+  files.reserve(change.count);
+  MemoryInputStream records(change.records, change.records_length);
+  PathCodec codec;
+  bool complete = true;
+  try {
+    for (uint32_t i = 0; i < change.count && complete; ++i) {
+      files.push_back(new File(session.box->getBaseDir(), session.box_hash));
+      files.back()->deserialize(records, codec);
+      complete = !records.fail();
+    }
+  } catch (std::exception& e) {
+    std::cerr << "[E] malformed metadata changes: " << e.what() << std::endl;
+    complete = false;
   }
+
+  for (std::vector<File*>::iterator i = files.begin(); i != files.end(); ++i) {
+    if (complete) {
+      if ((*i)->isToBeDeleted()) {
+        (*i)->remove();
+      } else {
+        if ((*i)->exists()) {
+          (*i)->truncate();
+        } else {
+          (*i)->create();
+        }
+        (*i)->storeMetadata();
+      }
+    }
+    delete *i;
+  }
+  return complete;
 }
 
 bool Boxoffice::checkEvent(fsm::state_t const state,
@@ -944,29 +1202,391 @@ bool Boxoffice::checkEvent(fsm::state_t const state,
   return true;
 }
 
-int Boxoffice::updateTimestamp(std::stringstream* sstream) {
-  char node_hash_s[F_GENERIC_HASH_LEN];
-  sstream->read(node_hash_s, F_GENERIC_HASH_LEN);
-  unsigned char node_hash[F_GENERIC_HASH_LEN];
-  std::memcpy(node_hash, node_hash_s, F_GENERIC_HASH_LEN);
-  delete current_node_hash_;
-  current_node_hash_ = new Hash(node_hash);
-  uint64_t node_timestamp, local_timestamp;
-  uint16_t offset;
-  char* node_timestamp_c = new char[8];
-  sstream->seekg(1, std::ios_base::cur);
-  sstream->read(node_timestamp_c, 8);
-  std::memcpy(&node_timestamp, node_timestamp_c, 8);
-  subscribers[current_node_hash_].last_timestamp = be64toh(node_timestamp);
-  local_timestamp = std::chrono::duration_cast< std::chrono::milliseconds >(
+/**
+ * Every receiver answers the metadata of a new file with the ranges it 
+ * is still missing, with the content hash of the version it has for a 
+ * delta or with 'F' if it needs the whole file, see msg::ResumeReply. 
+ * Once all nodes answered, the union of the ranges or the common base 
+ * of a delta is handed to the dispatcher, unless the file has to be 
+ * sent completely anyway. 
+ */
+void Boxoffice::collectResumeRanges(box_session_t& session, const FrameView& frame) {
+  msg::ResumeReply reply;
+  if ( !msg::decode<fsm::status_131>(frame, reply)
+    || !session.replied.insert(current_node_index_) ) return;
+
+  if (reply.tag == 'F') {
+    session.resume_full = true;
+  } else if (reply.tag == 'D') {
+    // a delta only works if all nodes have the same version
+    if ( !session.resume_delta_base.empty()
+      && session.resume_delta_base.compare(0, F_GENERIC_HASH_LEN,
+                                           reinterpret_cast<const char*>(reply.base),
+                                           F_GENERIC_HASH_LEN) != 0 ) {
+      session.resume_full = true;
+    } else {
+      session.resume_delta_base.assign(reinterpret_cast<const char*>(reply.base), F_GENERIC_HASH_LEN);
+      if (reply.in_place) session.resume_delta_in_place = true;
+    }
+  } else {
+    for (size_t i = 0; i < reply.ranges.size() && i < F_MAXIMUM_RESUME_RANGES; ++i) {
+      if (reply.ranges[i].first >= reply.ranges[i].second) {
+        session.resume_full = true;
+        break;
+      }
+      session.resume_ranges.push_back(reply.ranges[i]);
+    }
+  }
+
+  if ( session.replied.size() != subscribers.size() ) return;
+
+  uint64_t timestamp =
+    std::chrono::duration_cast< std::chrono::milliseconds >(
+      std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+  // too late, the dispatcher is already sending the whole file
+  if (session.resume_full || timestamp >= session.current_timing_offset) return;
+  // resuming some nodes while others want a delta is not worth it
+  if (!session.resume_delta_base.empty() && !session.resume_ranges.empty()) return;
+
+  Frame message(F_SIGTYPE_FSM, fsm::status_131);
+  message.setTimestamp(session.current_timing_offset)
+         .setBox(session.box_hash->getBytes())
+         .setLane(session.lane);
+  msg::ResumeReply merged;
+  if (!session.resume_delta_base.empty()) {
+    merged.tag = 'D';
+    merged.base = reinterpret_cast<const unsigned char*>(session.resume_delta_base.data());
+    merged.in_place = session.resume_delta_in_place;
+    merged.encode(message);
+    s_send(*session.disp_channel, message, true);
+    return;
+  }
+
+  // merge the ranges of all nodes
+  std::sort(session.resume_ranges.begin(), session.resume_ranges.end());
+  merged.tag = 'R';
+  for (std::vector< std::pair<uint64_t, uint64_t> >::iterator i = session.resume_ranges.begin();
+       i != session.resume_ranges.end(); ++i) {
+    if (!merged.ranges.empty() && i->first <= merged.ranges.back().second)
+      merged.ranges.back().second = std::max(merged.ranges.back().second, i->second);
+    else
+      merged.ranges.push_back(*i);
+  }
+  merged.encode(message);
+  s_send(*session.disp_channel, message, true);
+}
+
+int Boxoffice::updateTimestamp(const FrameView& frame) {
+  // only a node not seen before gets a key of its own and the next 
+  // free index
+  int index = peer_ids_.find(frame.node());
+  if ( index < 0 ) {
+    node_t new_node = node_t();
+    new_node.index = peer_ids_.intern(frame.node());
+    index = static_cast<int>(new_node.index);
+    peers_.push_back(&subscribers.emplace(new Hash(frame.node()), new_node).first->second);
+  }
+  current_node_index_ = static_cast<size_t>(index);
+  peers_[index]->last_timestamp = frame.timestamp();
+  uint64_t local_timestamp = std::chrono::duration_cast< std::chrono::milliseconds >(
     std::chrono::system_clock::now().time_since_epoch()
   ).count();
-  offset = local_timestamp - subscribers[current_node_hash_].last_timestamp;
-  subscribers[current_node_hash_].offset = offset;
+
+  // the node reports the delay of our heartbeats in turn, see Heartbeater
+  int64_t delay_in = static_cast<int64_t>(local_timestamp - frame.timestamp());
+  if ( isOwnNode(frame.offset()) )
+    clock_.addSample(s_node_id(frame.node()), delay_in, static_cast<int64_t>(frame.length()));
+  Frame report(F_SIGTYPE_CLOCK, 0);
+  report.setNode(frame.node())
+        .setLength(static_cast<uint64_t>(delay_in));
+  s_send(*bo_hb_channel, report, true);
 
   return 0;
 }
 
+/**
+ * \fn Boxoffice::isOwnNode
+ *
+ * Nodes name the node a delay report is for by the first bytes of its 
+ * hash, see Heartbeater::run. 
+ */
+bool Boxoffice::isOwnNode(const uint64_t node_id) const {
+  return std::find(node_ids_.begin(), node_ids_.end(), node_id) != node_ids_.end();
+}
+
+/**
+ * \fn Boxoffice::getDeadlineOffset
+ *
+ * Milliseconds from now to a deadline all nodes learn of in time: the 
+ * given number of heartbeat ticks plus the largest round trip to any 
+ * node, times the safety multiplier, but at least the floor. Deadlines 
+ * are exchanged in flock time, so clock offsets need no allowance. A 
+ * random delay of up to as much again is added, so the timing of a 
+ * transfer tells nothing about its sender. 
+ */
+uint64_t Boxoffice::getDeadlineOffset(const uint32_t ticks) const {
+  int64_t rtt = 0;
+  for (node_map::const_iterator i = subscribers.begin(); i != subscribers.end(); ++i) {
+    const uint64_t node = s_node_id(i->first->getBytes());
+    rtt = std::max<int64_t>(rtt, clock_.has(node) ? clock_.getDelay(node)
+                                                  : F_OFFSET_UNKNOWN_RTT);
+  }
+
+  uint64_t needed = static_cast<uint64_t>(
+    offset_multiplier_ * (rtt + ticks * heartbeat_tick_));
+  needed = std::max<uint64_t>(needed, offset_floor_);
+  return needed + randombytes_uniform(std::min<uint64_t>(needed, UINT32_MAX - 1) + 1);
+}
+
+box_session_t* Boxoffice::findSession(const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                                      const uint8_t lane) {
+  int box = box_ids_.find(box_hash);
+  if ( box < 0 || lane >= sessions_[box].size() ) return nullptr;
+  return sessions_[box][lane];
+}
+
+/**
+ * \fn Boxoffice::queueLocalChange
+ *
+ * Only the last version of a path is sent: a change replaces the one 
+ * queued for the path before, new data supersedes a queued metadata 
+ * change and a deletion cancels the data still queued. Once the FSM 
+ * left ready_state it is committed to the first change of a queue, 
+ * which is then sent anyway; the deletion follows it. 
+ */
+void Boxoffice::queueLocalChange(box_session_t& session,
+                                 PendingChanges& file_list,
+                                 File* new_file) {
+  const bool committed = session.state != fsm::ready_state;
+  std::vector<File*> dropped;
+  if ( &file_list == &session.file_list_data )
+    dropped.push_back(session.file_list_metadata.cancel(new_file->getPath(), committed));
+  else if ( new_file->isToBeDeleted() )
+    dropped.push_back(session.file_list_data.cancel(new_file->getPath(), committed));
+  dropped.push_back(file_list.push_back(new_file));
+
+  // the file being sent may be queued again for a resend
+  for (std::vector<File*>::iterator i = dropped.begin(); i != dropped.end(); ++i) {
+    if ( *i != nullptr && *i == session.hashing_file ) cancelContentHash(session);
+    if ( *i != nullptr && *i != session.sending_file ) delete *i;
+  }
+}
+
+/**
+ * \fn Boxoffice::requestContentHash
+ *
+ * Has the ContentHasher hash the file at the front of the data queue 
+ * while it waits for its announcement, one file per session at a time; 
+ * the next is requested when the hash comes back. Files without 
+ * content are done right away. 
+ */
+void Boxoffice::requestContentHash(box_session_t& session) {
+  if ( session.hashing != nullptr || session.file_list_data.empty() ) return;
+  File* file = session.file_list_data.front();
+  if ( file->getAnnouncedContentHash() != nullptr ) return;
+
+  std::stringstream record;
+  record << *file;
+  const size_t holes = msg::FileAnnouncement::maximumHoles(record.str().size());
+  if ( file->isToBeDeleted() || file->getType() != boost::filesystem::regular_file ) {
+    file->prepareAnnouncement(holes);
+    return;
+  }
+
+  hash_job_t* job = new hash_job_t();
+  job->kind = hash_job_t::hash;
+  job->box = box_ids_.find(session.box_hash->getBytes());
+  job->lane = session.lane;
+  job->box_dir = session.box->getBaseDir();
+  job->box_hash = session.box_hash;
+  job->record = record.str();
+  job->max_holes = holes;
+  if ( !hasher_.submit(job) ) {
+    // with that many jobs out, waiting would not be faster
+    delete job;
+    file->prepareAnnouncement(holes);
+    file->closeFile();
+    return;
+  }
+  session.hashing = job;
+  session.hashing_file = file;
+}
+
+// the file is gone, its hash is dropped when the job comes back
+void Boxoffice::cancelContentHash(box_session_t& session) {
+  if ( session.hashing == nullptr ) return;
+  session.hashing->cancelled = true;
+  session.hashing_file = nullptr;
+}
+
+/**
+ * \fn Boxoffice::awaitContentHash
+ *
+ * A file is announced with its content hash. If the transition would 
+ * announce the front of the data queue before its hash is in, the 
+ * session stays in its state and takes the transition once the hash 
+ * arrives, see takeContentHashes. 
+ */
+bool Boxoffice::awaitContentHash(box_session_t& session,
+                                 fsm::event_t const event,
+                                 fsm::status_t const status) {
+  const fsm::state_t new_state = fsm::get_new_state(session.state, event, status);
+  if ( new_state == session.state
+    || (  new_state != fsm::sending_new_file_metadata_state
+       && new_state != fsm::sending_new_file_metadata_with_more_state )
+    || session.file_list_data.empty()
+    || session.file_list_data.front()->getAnnouncedContentHash() != nullptr ) return false;
+
+  session.awaiting_state = session.state;
+  session.awaiting_status = status;
+  requestContentHash(session);
+  return true;
+}
+
+/**
+ * \fn Boxoffice::takeContentHashes
+ *
+ * Takes back the jobs the ContentHasher finished. A hash goes to the 
+ * file it was requested for unless that was dropped meanwhile; a 
+ * session waiting for it then takes its transition, provided it is 
+ * still in the state it waited in. Verified files are finished. 
+ */
+int Boxoffice::takeContentHashes() {
+  int ret_val = 0;
+  hasher_.clearWakeup();
+
+  hash_job_t* job;
+  while ( hasher_.take(job) ) {
+    if ( job->kind == hash_job_t::verify ) {
+      verifying_.erase(std::find(verifying_.begin(), verifying_.end(), job));
+      finishReceivedFile(job);
+      continue;
+    }
+
+    box_session_t& session = *sessions_[job->box][job->lane];
+    if ( !job->cancelled && session.hashing_file != nullptr )
+      session.hashing_file->setAnnouncement(job->content_hash, job->holes);
+    session.hashing = nullptr;
+    session.hashing_file = nullptr;
+    delete job;
+    requestContentHash(session);
+
+    const fsm::state_t state = session.awaiting_state;
+    const fsm::status_t status = session.awaiting_status;
+    if ( status == fsm::NULL_status ) continue;
+    // the front may have changed to a file still being hashed
+    if ( session.state == state
+      && !session.file_list_data.empty()
+      && session.file_list_data.front()->getAnnouncedContentHash() == nullptr ) continue;
+    session.awaiting_state = fsm::NULL_state;
+    session.awaiting_status = fsm::NULL_status;
+    if ( session.state != state || session.file_list_data.empty() ) continue;
+
+    fsm::event_t event = fsm::get_event_by_status_code(status);
+    if ( !fsm::check_event(session.state, event, status) ) continue;
+    dispatchFile(session, event, status);
+    if ( ret_val == 0 ) ret_val = changeState(session, event, status);
+  }
+
+  return ret_val;
+}
+
+/**
+ * \fn Boxoffice::verifyReceivedFile
+ *
+ * Hands the completely received file and its journal to the 
+ * ContentHasher. Verifying the content yields the signature of the new 
+ * version on the way, so its next version may come as a delta. 
+ */
+void Boxoffice::verifyReceivedFile(box_session_t& session) {
+  hash_job_t* job = new hash_job_t();
+  job->kind = hash_job_t::verify;
+  job->box_hash = session.box_hash;
+  job->file = session.receiving_file;
+  job->journal = session.receiving_journal;
+  job->holes = session.receiving_holes;
+  session.receiving_file = nullptr;
+  session.receiving_journal = nullptr;
+
+  if ( hasher_.submit(job) ) {
+    verifying_.push_back(job);
+  } else {
+    ContentHasher::run(*job);
+    finishReceivedFile(job);
+  }
+}
+
+void Boxoffice::finishReceivedFile(hash_job_t* job) {
+  if ( job->ok && job->file->finishFileData() ) {
+    job->journal->remove();
+    job->signature.save(Signature::getSignaturePath(journal_dir_,
+                                                    job->box_hash->getBytes(),
+                                                    job->file->getPath()));
+  } else {
+    std::cerr << "[E] received file " << job->file->getPath()
+              << " failed verification, discarding it" << std::endl;
+    job->journal->reset();
+  }
+  delete job->journal;
+  delete job->file;
+  delete job;
+}
+
+/**
+ * \fn Boxoffice::awaitVerification
+ *
+ * Blocks until the ContentHasher is done with a received version of 
+ * the path, before a new one is written over it. 
+ */
+void Boxoffice::awaitVerification(const Hash* box_hash, const std::string& path) {
+  struct pollfd results = { hasher_.fd(), POLLIN, 0 };
+  while (true) {
+    bool pending = false;
+    for (std::vector<hash_job_t*>::const_iterator i = verifying_.begin();
+         i != verifying_.end() && !pending; ++i)
+      pending = (*i)->box_hash == box_hash && (*i)->file->getPath() == path;
+    if ( !pending ) return;
+
+    if ( ::poll(&results, 1, -1) < 0 && errno != EINTR ) return;
+    takeContentHashes();
+  }
+}
+
+/**
+ * \fn Boxoffice::pickSession
+ *
+ * Local changes go to the first lane of their box. Pipelined, they go 
+ * to the lane a change of the same path is queued in, else to an idle 
+ * lane or, if all lanes are busy, to the one with the fewest files 
+ * queued, so one lane announces its next file while another sends the 
+ * data of its current one. 
+ */
+box_session_t* Boxoffice::pickSession(const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                                      const std::string& path) {
+  int box = box_ids_.find(box_hash);
+  if ( box < 0 ) return nullptr;
+  std::vector<box_session_t*>& lanes = sessions_[box];
+  if ( !pipelined_ ) return lanes.front();
+
+  // changes of a path have to meet in one lane to be merged
+  for (std::vector<box_session_t*>::iterator i = lanes.begin(); i != lanes.end(); ++i)
+    if ( (*i)->file_list_data.has(path) || (*i)->file_list_metadata.has(path) ) return *i;
+
+  box_session_t* picked = nullptr;
+  size_t picked_queued = 0;
+  for (std::vector<box_session_t*>::iterator i = lanes.begin();
+       i != lanes.end(); ++i) {
+    if ( (*i)->state == fsm::ready_state ) return *i;
+    size_t queued = (*i)->file_list_data.size() + (*i)->file_list_metadata.size();
+    if ( picked == nullptr || queued < picked_queued ) {
+      picked = *i;
+      picked_queued = queued;
+    }
+  }
+  return picked;
+}
+
 
 
 void *publisher_thread(zmqpp::context* z_ctx, host_t host)
@@ -993,9 +1613,9 @@ void *heartbeater_thread(zmqpp::context* z_ctx, fsm::status_t status)
   return (NULL);
 }
 
-void *dispatcher_thread(zmqpp::context* z_ctx, fsm::status_t status)
+void *dispatcher_thread(zmqpp::context* z_ctx, fsm::status_t status, const unsigned char* box_hash)
 {
-  Dispatcher* disp = new Dispatcher(z_ctx, status);
+  Dispatcher* disp = new Dispatcher(z_ctx, status, box_hash);
 
   disp->run();
   disp->sendExitSignal();
@@ -1024,5 +1644,29 @@ void *box_thread(Box* box)
 
   delete box;
 
+  return (NULL);
+}
+
+void *reactor_thread(zmqpp::context* z_ctx, reactor_shard_t shard)
+{
+  std::vector<Transmitter*> transmitters;
+  for (std::vector<host_t>::iterator i = shard.hosts.begin(); i != shard.hosts.end(); ++i)
+    transmitters.push_back(new Publisher(z_ctx, *i));
+  for (std::vector<node_t>::iterator i = shard.nodes.begin(); i != shard.nodes.end(); ++i)
+    transmitters.push_back(new Subscriber(z_ctx, *i));
+  transmitters.insert(transmitters.end(), shard.boxes.begin(), shard.boxes.end());
+
+  // the first of them to see the interrupt stops all of them
+  Reactor reactor;
+  int attached = 0;
+  for (std::vector<Transmitter*>::iterator i = transmitters.begin(); i != transmitters.end(); ++i)
+    if ( (*i)->attach(reactor) == 0 ) ++attached;
+  if ( attached > 0 ) reactor.run();
+
+  for (std::vector<Transmitter*>::iterator i = transmitters.begin(); i != transmitters.end(); ++i) {
+    (*i)->sendExitSignal();
+    delete *i;
+  }
+
   return (NULL);
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+ * \file      buffer_pool.cpp
+ * \brief     Per-thread pool of fixed-size message buffers.
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#include "buffer_pool.hpp"
+
+// orphans the pool of a thread when the thread exits; the pool itself
+// lives on until zmq returned the last buffer sent from that thread
+class BufferPoolOwner {
+ public:
+    BufferPoolOwner() : pool_(new BufferPool()) {}
+    ~BufferPoolOwner() { pool_->orphan(); }
+    BufferPool* get() const { return pool_; }
+ private:
+    BufferPool* pool_;
+};
+
+BufferPool* BufferPool::getInstance() {
+  static thread_local BufferPoolOwner owner;
+  return owner.get();
+}
+
+BufferPool::BufferPool() :
+  available_(0),
+  outstanding_(0),
+  allocated_(0),
+  orphaned_(false) {}
+
+BufferPool::~BufferPool() {
+  for (size_t i = 0; i < available_; ++i)
+    delete[] free_[i];
+}
+
+char* BufferPool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++outstanding_;
+    if ( available_ > 0 ) return free_[--available_];
+    ++allocated_;
+  }
+  return new char[F_FRAME_BUFFER_SIZE];
+}
+
+void BufferPool::put(char* buffer) {
+  bool remove = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --outstanding_;
+    if ( available_ < F_BUFFER_POOL_SIZE ) {
+      free_[available_++] = buffer;
+      buffer = nullptr;
+    }
+    remove = orphaned_ && outstanding_ == 0;
+  }
+  delete[] buffer;
+  if ( remove ) delete this;
+}
+
+void BufferPool::release(void* data, void* hint) {
+  static_cast<BufferPool*>(hint)->put(static_cast<char*>(data));
+}
+
+size_t BufferPool::available() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return available_;
+}
+size_t BufferPool::allocated() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return allocated_;
+}
+
+void BufferPool::orphan() {
+  bool remove = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    orphaned_ = true;
+    remove = outstanding_ == 0;
+  }
+  if ( remove ) delete this;
+}
@@ -0,0 +1,224 @@
+/**
+ * \file      chunker.cpp
+ * \brief     Content-defined chunking and the chunk store. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "chunker.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <sodium.h>
+#include <boost/filesystem.hpp>
+
+#include "hash.hpp"
+
+namespace {
+  /**
+   * The gear table has to be the same on all nodes, so it is derived 
+   * from a fixed seed (splitmix64) instead of being random. 
+   */
+  struct gear_table_t {
+    uint64_t values[256];
+    gear_table_t() {
+      uint64_t seed = 0x666c6f636b737900ULL;
+      for (int i = 0; i < 256; ++i) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        values[i] = z ^ (z >> 31);
+      }
+    }
+  };
+  const gear_table_t gear;
+
+  // the gear hash shifts left, so its high bits depend on the most
+  // bytes; a stricter mask before the average size and a looser one
+  // after it narrow the distribution of chunk sizes
+  const uint64_t mask_small = ~0ULL << (64 - 15);
+  const uint64_t mask_large = ~0ULL << (64 - 11);
+}
+
+Chunker::Chunker(const int fd,
+                 const uint64_t size,
+                 const uint64_t offset,
+                 Prefetcher* prefetcher) :
+  fd_(fd),
+  prefetcher_(prefetcher),
+  size_(size),
+  buffer_(2 * F_CDC_MAXIMUM_CHUNK_SIZE),
+  buffer_offset_(offset),
+  buffer_length_(0),
+  pos_(0) {}
+
+/**
+ * \fn Chunker::findBoundary
+ *
+ * Returns the length of the chunk starting at data, i.e. the position 
+ * right after the first cut point, as in FastCDC. 
+ */
+uint64_t Chunker::findBoundary(const unsigned char* data, const uint64_t length) {
+  if (length <= F_CDC_MINIMUM_CHUNK_SIZE) return length;
+
+  uint64_t end = std::min<uint64_t>(length, F_CDC_MAXIMUM_CHUNK_SIZE);
+  uint64_t normal = std::min<uint64_t>(end, F_CDC_AVERAGE_CHUNK_SIZE);
+  uint64_t fingerprint = 0;
+  uint64_t i = F_CDC_MINIMUM_CHUNK_SIZE;
+  for (; i < normal; ++i) {
+    fingerprint = (fingerprint << 1) + gear.values[data[i]];
+    if (!(fingerprint & mask_small)) return i + 1;
+  }
+  for (; i < end; ++i) {
+    fingerprint = (fingerprint << 1) + gear.values[data[i]];
+    if (!(fingerprint & mask_large)) return i + 1;
+  }
+  return end;
+}
+
+/**
+ * \fn Chunker::next
+ *
+ * Returns the next chunk of the file. data points to its content and 
+ * stays valid until the next call. 
+ */
+bool Chunker::next(Chunk& chunk, const unsigned char** data) {
+  uint64_t remaining = size_ - (buffer_offset_ + pos_);
+  if (remaining == 0) return false;
+
+  uint64_t wanted = std::min<uint64_t>(remaining, F_CDC_MAXIMUM_CHUNK_SIZE);
+  if (buffer_length_ - pos_ < wanted) {
+    std::memmove(buffer_.data(), buffer_.data() + pos_, buffer_length_ - pos_);
+    buffer_offset_ += pos_;
+    buffer_length_ -= pos_;
+    pos_ = 0;
+    while (buffer_length_ < wanted) {
+      size_t want = std::min<uint64_t>(buffer_.size() - buffer_length_,
+                                       size_ - (buffer_offset_ + buffer_length_));
+      off_t offset = static_cast<off_t>(buffer_offset_ + buffer_length_);
+      ssize_t r = prefetcher_ != nullptr
+                ? prefetcher_->read(buffer_.data() + buffer_length_, want, offset)
+                : ::pread(fd_, buffer_.data() + buffer_length_, want, offset);
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) break;
+      buffer_length_ += r;
+    }
+    // the file shrank while we were reading it
+    if (buffer_length_ < wanted) {
+      size_ = buffer_offset_ + buffer_length_;
+      wanted = buffer_length_;
+      if (wanted == 0) return false;
+    }
+  }
+
+  chunk.offset = buffer_offset_ + pos_;
+  chunk.length = findBoundary(buffer_.data() + pos_, wanted);
+  crypto_generichash(chunk.hash, F_GENERIC_HASH_LEN,
+                     buffer_.data() + pos_, chunk.length, NULL, 0);
+  if (data != nullptr) *data = buffer_.data() + pos_;
+  pos_ += chunk.length;
+  return true;
+}
+
+void ChunkStore::setDirectory(const std::string& directory) {
+  directory_ = directory;
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(directory_, ec);
+}
+
+/**
+ * \fn ChunkStore::add
+ *
+ * Records where a chunk can be found. The entry is written to a 
+ * temporary file and renamed, so readers never see a partial entry. 
+ */
+void ChunkStore::add(const Chunk& chunk, const std::string& path) {
+  if (directory_.empty()) return;
+
+  std::string entry_path = getEntryPath(chunk.hash);
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(
+    boost::filesystem::path(entry_path).parent_path(), ec);
+
+  std::string tmp_path = entry_path + ".XXXXXX";
+  int fd = ::mkstemp(&tmp_path[0]);
+  if (fd < 0) return;
+  std::string entry = std::to_string(chunk.offset) + " "
+                    + std::to_string(chunk.length) + " " + path;
+  bool written = ::write(fd, entry.data(), entry.size())
+                   == static_cast<ssize_t>(entry.size());
+  ::close(fd);
+  if (!written || ::rename(tmp_path.c_str(), entry_path.c_str()) != 0)
+    ::unlink(tmp_path.c_str());
+}
+
+void ChunkStore::addFile(const int fd, const uint64_t size, const std::string& path) {
+  if (directory_.empty()) return;
+
+  Chunker chunker(fd, size);
+  Chunk chunk;
+  while (chunker.next(chunk, nullptr))
+    add(chunk, path);
+}
+
+bool ChunkStore::has(const unsigned char hash[F_GENERIC_HASH_LEN]) const {
+  if (directory_.empty()) return false;
+  return ::access(getEntryPath(hash).c_str(), F_OK) == 0;
+}
+
+/**
+ * \fn ChunkStore::get
+ *
+ * Reads a chunk from where it was last seen. Returns false if there is 
+ * no entry or if the data there changed in the meantime; such an entry 
+ * is removed. 
+ */
+bool ChunkStore::get(const unsigned char hash[F_GENERIC_HASH_LEN],
+                     const uint64_t length,
+                     std::vector<char>& data) const {
+  if (directory_.empty()) return false;
+
+  std::string entry_path = getEntryPath(hash);
+  std::ifstream entry(entry_path);
+  uint64_t offset, entry_length;
+  std::string path;
+  if (!(entry >> offset >> entry_length)) return false;
+  entry.get();
+  std::getline(entry, path);
+  entry.close();
+  if (entry_length != length) return false;
+
+  data.resize(length);
+  bool valid = false;
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0) {
+    uint64_t read = 0;
+    while (read < length) {
+      ssize_t r = ::pread(fd, data.data() + read, length - read,
+                          static_cast<off_t>(offset + read));
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) break;
+      read += r;
+    }
+    ::close(fd);
+    if (read == length) {
+      unsigned char check[F_GENERIC_HASH_LEN];
+      crypto_generichash(check, F_GENERIC_HASH_LEN,
+                         reinterpret_cast<unsigned char*>(data.data()), length, NULL, 0);
+      valid = std::memcmp(check, hash, F_GENERIC_HASH_LEN) == 0;
+    }
+  }
+
+  if (!valid) ::unlink(entry_path.c_str());
+  return valid;
+}
+
+const std::string ChunkStore::getEntryPath(const unsigned char hash[F_GENERIC_HASH_LEN]) const {
+  std::string name = Hash(hash).getString();
+  return (boost::filesystem::path(directory_) / name.substr(0, 2) / name).string();
+}
@@ -0,0 +1,86 @@
+/**
+ * \file      clock_sync.cpp
+ * \brief     Clock offset and delay estimates of the nodes of a flock.
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#include "clock_sync.hpp"
+
+#include <algorithm>
+
+ClockSync::ClockSync() :
+  nodes_(),
+  consensus_(0) {}
+
+/**
+ * \fn ClockSync::addSample
+ *
+ * delay_in is the time the last heartbeat of the node took to us,
+ * delay_out the time our heartbeat took to the node as it reported;
+ * both include the clock offset, once added and once subtracted.
+ */
+void ClockSync::addSample(const uint64_t node, const int64_t delay_in, const int64_t delay_out) {
+  node_clock_t& clock = nodes_[node];
+  sample_t sample = { (delay_in - delay_out) / 2, std::max<int64_t>(delay_in + delay_out, 0) };
+  if ( clock.samples.size() < F_CLOCK_SYNC_WINDOW ) {
+    clock.samples.push_back(sample);
+  } else {
+    clock.samples[clock.next] = sample;
+    clock.next = (clock.next + 1) % F_CLOCK_SYNC_WINDOW;
+  }
+
+  clock.estimate = clock.samples.front();
+  for (std::vector<sample_t>::const_iterator i = clock.samples.begin();
+       i != clock.samples.end(); ++i)
+    if ( i->delay < clock.estimate.delay ) clock.estimate = *i;
+
+  updateConsensus();
+}
+
+bool ClockSync::has(const uint64_t node) const {
+  return nodes_.find(node) != nodes_.end();
+}
+
+int64_t ClockSync::getOffset(const uint64_t node) const {
+  std::unordered_map<uint64_t, node_clock_t>::const_iterator clock = nodes_.find(node);
+  return clock == nodes_.end() ? 0 : clock->second.estimate.offset;
+}
+
+int64_t ClockSync::getDelay(const uint64_t node) const {
+  std::unordered_map<uint64_t, node_clock_t>::const_iterator clock = nodes_.find(node);
+  return clock == nodes_.end() ? 0 : clock->second.estimate.delay;
+}
+
+int64_t ClockSync::getConsensusOffset() const {
+  return consensus_;
+}
+
+uint64_t ClockSync::toFlockTime(const uint64_t local) const {
+  return local - consensus_;
+}
+
+uint64_t ClockSync::toLocalTime(const uint64_t flock) const {
+  return flock + consensus_;
+}
+
+/**
+ * \fn ClockSync::updateConsensus
+ *
+ * The median of the offsets of all nodes, this one with an offset of
+ * 0 included, is the offset of the median clock. Averaging would let a
+ * single node with a clock far off move the flock time.
+ */
+void ClockSync::updateConsensus() {
+  std::vector<int64_t> offsets(1, 0);
+  for (std::unordered_map<uint64_t, node_clock_t>::const_iterator i = nodes_.begin();
+       i != nodes_.end(); ++i)
+    offsets.push_back(i->second.estimate.offset);
+
+  std::sort(offsets.begin(), offsets.end());
+  const size_t middle = offsets.size() / 2;
+  if ( offsets.size() % 2 == 1 )
+    consensus_ = offsets[middle];
+  else
+    consensus_ = (offsets[middle - 1] + offsets[middle]) / 2;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file      compression.cpp
+ * \brief     Compression of literal file data packages. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "compression.hpp"
+
+#include <endian.h>
+#include <zlib.h>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+/**
+ * \fn Compression::pack
+ *
+ * Compresses as much of data as fits into one package and returns how 
+ * many bytes of data were packed. Returns 0 if the data should rather 
+ * be sent as it is, because it does not compress or because no more 
+ * than F_MAXIMUM_FILE_PACKAGE_SIZE bytes of it would fit anyway. 
+ */
+uint64_t Compression::pack(const char* data,
+                           const uint64_t length,
+                           std::string& packed) {
+  const uint64_t capacity = F_MAXIMUM_FILE_PACKAGE_SIZE - 4;
+  uint64_t input = std::min<uint64_t>(length, F_COMPRESSION_MAXIMUM_INPUT);
+  // allocated once per thread
+  static thread_local std::vector<Bytef> output(compressBound(F_COMPRESSION_MAXIMUM_INPUT));
+
+  // the compressed size is only known afterwards, so each attempt
+  // scales the input down to what should fit
+  for (int attempt = 0; attempt < 4; ++attempt) {
+    if (input <= F_MAXIMUM_FILE_PACKAGE_SIZE) return 0;
+
+    uLongf output_length = output.size();
+    if (compress2(output.data(), &output_length,
+                  reinterpret_cast<const Bytef*>(data), input, Z_BEST_SPEED) != Z_OK)
+      return 0;
+    if (attempt == 0 && output_length > input * F_COMPRESSION_MINIMUM_RATIO)
+      return 0;
+
+    if (output_length <= capacity) {
+      uint32_t output_length_be = htobe32(static_cast<uint32_t>(output_length));
+      packed.assign(reinterpret_cast<const char*>(&output_length_be), 4);
+      packed.append(reinterpret_cast<const char*>(output.data()), output_length);
+      return input;
+    }
+    input = input * capacity / output_length * 95 / 100;
+  }
+
+  return 0;
+}
+
+/**
+ * \fn Compression::unpack
+ *
+ * Restores exactly length bytes from a packed payload. 
+ */
+bool Compression::unpack(const char* packed,
+                         const uint64_t packed_length,
+                         char* data,
+                         const uint64_t length) {
+  if (packed_length < 4) return false;
+  uint32_t compressed_length_be;
+  std::memcpy(&compressed_length_be, packed, 4);
+  uint32_t compressed_length = be32toh(compressed_length_be);
+  if (compressed_length > packed_length - 4) return false;
+
+  uLongf data_length = length;
+  return uncompress(reinterpret_cast<Bytef*>(data), &data_length,
+                    reinterpret_cast<const Bytef*>(packed + 4), compressed_length) == Z_OK
+      && data_length == length;
+}
@@ -53,6 +53,26 @@ int Config::initialize(int argc, char* argv[])
                 "Add path of a directory to watch (multiple arguments allowed)")
             ("hostname,p", po::value<std::vector <std::string> >(&hostnames),
                 "Add a name for this machine under which other nodes can reach it (multiple arguments allowed)")
+            ("staging", po::value<bool>(&c->staging_)->default_value(false),
+                "Receive files into a hidden staging file and move it over the target once complete")
+            ("compression", po::value<bool>(&c->compression_)->default_value(F_COMPRESSION_DEFAULT),
+                "Compress file data that compresses well, so each package carries more of it")
+            ("fsync-interval", po::value<uint32_t>(&c->fsync_interval_)->default_value(F_FSYNC_INTERVAL_DEFAULT),
+                "Milliseconds between grouped fsyncs of received files")
+            ("reactor-threads", po::value<uint32_t>(&c->reactor_threads_)->default_value(F_REACTOR_THREADS_DEFAULT),
+                "Threads shared by all publishers, subscribers and boxes, which are split among them by box; 0 gives each its own thread")
+            ("pipelined", po::value<bool>(&c->pipelined_)->default_value(F_PIPELINE_DEFAULT),
+                "Announce the next file of a box while the data of the current one is being sent")
+            ("heartbeat-interval", po::value<uint32_t>(&c->heartbeat_interval_)->default_value(F_HEARTBEAT_INTERVAL_DEFAULT),
+                "Milliseconds per heartbeat interval, in which every node sends the same number of heartbeats; has to be the same on all nodes")
+            ("offset-multiplier", po::value<double>(&c->offset_multiplier_)->default_value(F_OFFSET_MULTIPLIER_DEFAULT),
+                "Safety factor on the measured round trips when scheduling transfers")
+            ("offset-floor", po::value<uint32_t>(&c->offset_floor_)->default_value(F_OFFSET_FLOOR_DEFAULT),
+                "Milliseconds a transfer is scheduled ahead at least; a random delay of up to as much again is added")
+            ("journal-dir", po::value<std::string>(&c->journal_dir_)->default_value(F_JOURNAL_DIR),
+                "Directory for the journals of partially received files and the block signatures of synced ones")
+            ("chunk-store", po::value<std::string>(&c->chunk_store_dir_)->default_value(F_CHUNK_STORE_DIR),
+                "Directory of the index of content-defined chunks shared by all boxes")
         ;
 
         options.add(cmdline_options).add(generic_options);
@@ -84,6 +104,16 @@ int Config::initialize(int argc, char* argv[])
             ifs.close();
         }
 
+        // expand the journal and chunk store directories
+        wordexp_t expanded_journal_dir;
+        wordexp( c->journal_dir_.c_str(), &expanded_journal_dir, 0 );
+        c->journal_dir_ = expanded_journal_dir.we_wordv[0];
+        wordfree(&expanded_journal_dir);
+        wordexp_t expanded_chunk_store_dir;
+        wordexp( c->chunk_store_dir_.c_str(), &expanded_chunk_store_dir, 0 );
+        c->chunk_store_dir_ = expanded_chunk_store_dir.we_wordv[0];
+        wordfree(&expanded_chunk_store_dir);
+
         // parse keystore file
         wordexp_t expanded_keystore_file_path;
         if (keystore_file.empty()) {
@@ -152,6 +182,46 @@ const std::map< std::string, box_t >
     Config::getBoxes() const {
         return boxes_;
 }
+bool
+    Config::getStaging() const {
+        return staging_;
+}
+bool
+    Config::getCompression() const {
+        return compression_;
+}
+uint32_t
+    Config::getFsyncInterval() const {
+        return fsync_interval_;
+}
+uint32_t
+    Config::getReactorThreads() const {
+        return reactor_threads_;
+}
+bool
+    Config::getPipelined() const {
+        return pipelined_;
+}
+uint32_t
+    Config::getHeartbeatInterval() const {
+        return heartbeat_interval_;
+}
+double
+    Config::getOffsetMultiplier() const {
+        return offset_multiplier_;
+}
+uint32_t
+    Config::getOffsetFloor() const {
+        return offset_floor_;
+}
+const std::string
+    Config::getJournalDir() const {
+        return journal_dir_;
+}
+const std::string
+    Config::getChunkStoreDir() const {
+        return chunk_store_dir_;
+}
 
 int Config::doSanityCheck(boost::program_options::options_description* options, 
                           std::vector<std::string>* nodes, 
@@ -195,7 +265,7 @@ int Config::doSanityCheck(boost::program_options::options_description* options,
                 new_node.endpoint = endpoint;
                 new_node.f_subtype = F_SUBTYPE_TCP_BIDIR;
                 new_node.last_timestamp = 0;
-                new_node.offset = 0;
+                new_node.index = 0;
                 this->nodes_vec_.push_back( new_node );
             } else if ( F_MSG_DEBUG && std::regex_match( *i, 
                                    sm, 
@@ -206,7 +276,7 @@ int Config::doSanityCheck(boost::program_options::options_description* options,
                 new_node.endpoint = *i;
                 new_node.f_subtype = F_SUBTYPE_TCP_BIDIR;
                 new_node.last_timestamp = 0;
-                new_node.offset = 0;
+                new_node.index = 0;
                 this->nodes_vec_.push_back( new_node );
             } else {
                 std::cerr << "[E] Cannot process node '" << *i << "'" << std::endl;
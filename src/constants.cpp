@@ -1,219 +1,78 @@
-// TODO removed while loops, for it seems as though it waits at poll anyway 
-// and returns once something happened
-
-
 #include "constants.hpp"
 
-// wrapper for polling on one socket while simultaneously polling the broadcast
-void s_recv(zmqpp::socket &socket, zmqpp::socket &broadcast, std::stringstream &sstream)
+#include <endian.h>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// sends a frame as a single message part; zmq takes over the buffer 
+// and gives it back to the frame's pool once it is sent
+void s_send(zmqpp::socket &socket, Frame &frame, const bool dont_block)
 {
   zmqpp::message z_msg;
-  zmq_pollitem_t z_items[] = {
-    { static_cast<void *>(socket),    0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(broadcast), 0, ZMQ_POLLIN, 0 }
-  };
-
-  zmqpp::poller poller;
-  poller.add(z_items[0]);
-  poller.add(z_items[1]);
-
-  poller.poll();
-
-  if ( poller.events(z_items[0]) & ZMQ_POLLIN )
-  {
-    socket.receive(z_msg);
-    int parts = z_msg.parts();
-    for (int i = 0; i < parts; ++i)
-    {
-      sstream << z_msg.get(i);
-    }
-  }
-  else if ( poller.events(z_items[1]) & ZMQ_POLLIN )
-  {
-    broadcast.receive(z_msg);
-    sstream << z_msg.get(0);
-  }
+  const size_t size = frame.size();
+  BufferPool* pool = frame.pool();
+  z_msg.add_nocopy(frame.release(), size, &BufferPool::release, pool);
+  socket.send(z_msg, dont_block);
 }
-void s_recv(zmqpp::socket &socket,
-            zmqpp::socket &broadcast,
-            zmqpp::socket &heartbeat,
-            std::stringstream &sstream)
+void s_send(zmqpp::socket &socket, Frame &&frame, const bool dont_block)
 {
-  zmqpp::message z_msg;
-  zmq_pollitem_t z_items[] = {
-    { static_cast<void *>(socket),    0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(broadcast), 0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(heartbeat), 0, ZMQ_POLLIN, 0 }
-  };
+  s_send(socket, frame, dont_block);
+}
 
-  zmqpp::poller poller;
-  poller.add(z_items[0]);
-  poller.add(z_items[1]);
-  poller.add(z_items[2]);
+// view of the frame in the first part of a received message
+FrameView s_frame(const zmqpp::message &z_msg)
+{
+  if ( z_msg.parts() == 0 ) return FrameView();
+  return FrameView(z_msg.raw_data(0), z_msg.size(0));
+}
 
-  poller.poll();
+uint64_t s_node_id(const unsigned char node[F_GENERIC_HASH_LEN])
+{
+  uint64_t id;
+  std::memcpy(&id, node, sizeof(id));
+  return le64toh(id);
+}
 
-  if ( poller.events(z_items[0]) & ZMQ_POLLIN )
-  {
-    socket.receive(z_msg);
-    int parts = z_msg.parts();
-    for (int i = 0; i < parts; ++i)
-    {
-      sstream << z_msg.get(i);
-    }
-  }
-  if ( poller.events(z_items[1]) & ZMQ_POLLIN )
-  {
-    broadcast.receive(z_msg);
-    sstream << z_msg.get(0);
-  }
-  if ( poller.events(z_items[2]) & ZMQ_POLLIN )
-  {
-    heartbeat.receive(z_msg);
-    sstream << z_msg.get(0);
-  }
+// channels live as long as the process, so a thread may look one up 
+// before the other end exists
+FrameChannel* s_channel(const std::string &name)
+{
+  static std::mutex mutex;
+  static std::map< std::string, std::unique_ptr<FrameChannel> > channels;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::unique_ptr<FrameChannel>& channel = channels[name];
+  if ( !channel ) channel.reset(new FrameChannel());
+  return channel.get();
 }
-void s_recv(zmqpp::socket &socket,
-            zmqpp::socket &broadcast,
-            zmqpp::socket &heartbeat,
-            zmqpp::socket &dispatch,
-            std::stringstream &sstream)
+FrameChannel* s_channel(const std::string &name,
+                        const unsigned char box_hash[F_GENERIC_HASH_LEN])
 {
-  zmqpp::message z_msg;
-  zmq_pollitem_t z_items[] = {
-    { static_cast<void *>(socket),    0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(broadcast), 0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(heartbeat), 0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(dispatch), 0, ZMQ_POLLIN, 0 }
-  };
-
-  zmqpp::poller poller;
-  poller.add(z_items[0]);
-  poller.add(z_items[1]);
-  poller.add(z_items[2]);
-  poller.add(z_items[3]);
-
-  poller.poll();
+  return s_channel(name + std::string(reinterpret_cast<const char*>(box_hash),
+                                      F_GENERIC_HASH_LEN));
+}
 
-  if ( poller.events(z_items[0]) & ZMQ_POLLIN )
-  {
-    socket.receive(z_msg);
-    int parts = z_msg.parts();
-    for (int i = 0; i < parts; ++i)
-    {
-      sstream << z_msg.get(i);
-    }
-  }
-  if ( poller.events(z_items[1]) & ZMQ_POLLIN )
-  {
-    broadcast.receive(z_msg);
-    sstream << z_msg.get(0);
-  }
-  if ( poller.events(z_items[2]) & ZMQ_POLLIN )
-  {
-    heartbeat.receive(z_msg);
-    sstream << z_msg.get(0);
-  }
-  if ( poller.events(z_items[3]) & ZMQ_POLLIN )
+void s_send(FrameChannel &channel, Frame &frame, const bool dont_block)
+{
+  while ( !channel.push(std::move(frame)) )
   {
-    dispatch.receive(z_msg);
-    sstream << z_msg.get(0);
+    if ( dont_block ) return;
+    std::this_thread::yield();
   }
 }
-
-// wrapper for polling on three sockets, but non-blocking
-int s_recv_noblock(zmqpp::socket &socket, zmqpp::socket &socket2, zmqpp::socket &broadcast, std::stringstream &sstream, int timeout)
+void s_send(FrameChannel &channel, Frame &&frame, const bool dont_block)
 {
-  int return_val;
-  zmqpp::message z_msg;
-  zmq_pollitem_t z_items[] = {
-    { static_cast<void *>(socket),    0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(socket2),   0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(broadcast), 0, ZMQ_POLLIN, 0 }
-  };
-
-  zmqpp::poller poller;
-  poller.add(z_items[0]);
-  poller.add(z_items[1]);
-  poller.add(z_items[2]);
-
-  if ( poller.poll(timeout) ) {
-    if ( poller.events(z_items[0]) & ZMQ_POLLIN )
-    {
-      socket.receive(z_msg);
-      int parts = z_msg.parts();
-      for (int i = 0; i < parts; ++i)
-      {
-        sstream << z_msg.get(i);
-      }
-    }
-    if ( poller.events(z_items[1]) & ZMQ_POLLIN )
-    {
-      socket2.receive(z_msg);
-      int parts = z_msg.parts();
-      for (int i = 0; i < parts; ++i)
-      {
-        sstream << z_msg.get(0);
-      }
-    }
-    if ( poller.events(z_items[2]) & ZMQ_POLLIN )
-    {
-      broadcast.receive(z_msg);
-      sstream << z_msg.get(0);
-    }
-    return_val = 1;
-  } else {
-    return_val = 0;
-  }
-  return return_val;
+  s_send(channel, frame, dont_block);
 }
-
-// wrapper for polling on inotify event while simultaneously polling the broadcast
-void s_recv_in(zmqpp::socket &broadcast, zmqpp::socket &socket, int fd, std::stringstream &sstream)
+void s_send(const std::vector<FrameChannel*> &channels, Frame &frame, const bool dont_block)
 {
-  zmqpp::message z_msg;
-  zmq_pollitem_t z_items[] {
-    {                        nullptr, fd, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(broadcast),  0, ZMQ_POLLIN, 0 },
-    { static_cast<void *>(socket),     0, ZMQ_POLLIN, 0 }
-  };
-
-  zmqpp::poller poller;
-  poller.add(z_items[0]);
-  poller.add(z_items[1]);
-  poller.add(z_items[2]);
-
-  poller.poll();
-
-  if ( poller.events(z_items[0]) & ZMQ_POLLIN )
-  {
-    sstream << F_SIGTYPE_INOTIFY << " ";
-
-    int length, i = 0;
-    char buffer[F_IN_BUF_LEN];
-
-    length = read( fd, buffer, F_IN_BUF_LEN );
-    if ( length < 0 ) perror("inotify poll");
-
-    while( i < length )
-    {
-      struct inotify_event* event;
-      event = (struct inotify_event*) &buffer[i];
-      sstream << event->mask << " ";
-      sstream << event->wd   << " ";
-      sstream << event->name;
-      i += F_IN_EVENT_SIZE + event->len;
-      if ( i < length ) sstream << "\n";
-    }
-  }
-  if ( poller.events(z_items[1]) & ZMQ_POLLIN )
-  {
-      broadcast.receive(z_msg);
-      sstream << z_msg.get(0);
+  if ( channels.empty() ) return;
+  for (size_t i = 0; i + 1 < channels.size(); ++i) {
+    Frame copy(FrameView(frame.data(), frame.size()));
+    copy.pad(frame.size());
+    s_send(*channels[i], copy, dont_block);
   }
-  if ( poller.events(z_items[2]) & ZMQ_POLLIN )
-  {
-      broadcast.receive(z_msg);
-      sstream << z_msg.get(0);
-  }
-}
\ No newline at end of file
+  s_send(*channels.back(), frame, dont_block);
+}
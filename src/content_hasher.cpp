@@ -0,0 +1,134 @@
+/**
+ * \file      content_hasher.cpp
+ * \brief     Hashing and verification of whole files off the router. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "content_hasher.hpp"
+#include "path_codec.hpp"
+
+#include <sodium.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <chrono>
+
+ContentHasher::ContentHasher() :
+  requests_(),
+  results_(),
+  stopped_(false),
+  worker_() {}
+ContentHasher::~ContentHasher() {
+  stop();
+}
+
+void ContentHasher::start() {
+  if (worker_.joinable()) return;
+  worker_ = std::thread(&ContentHasher::work, this);
+}
+
+/**
+ * \fn ContentHasher::stop
+ *
+ * Lets the worker finish the jobs submitted so far and joins it. Jobs 
+ * that were not taken back are deleted, along with what they own. 
+ */
+void ContentHasher::stop() {
+  if (!worker_.joinable()) return;
+  // the worker may be waiting for room for its results
+  while (!requests_.push(nullptr)) {
+    discard();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  while (!stopped_) {
+    discard();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  worker_.join();
+  discard();
+  stopped_ = false;
+}
+
+void ContentHasher::discard() {
+  hash_job_t* job;
+  while (results_.pop(job)) {
+    delete job->journal;
+    delete job->file;
+    delete job;
+  }
+}
+
+bool ContentHasher::submit(hash_job_t* job) {
+  if (job == nullptr) return false;
+  return requests_.push(std::move(job));
+}
+bool ContentHasher::take(hash_job_t*& job) {
+  return results_.pop(job);
+}
+int ContentHasher::fd() const {
+  return results_.fd();
+}
+void ContentHasher::clearWakeup() {
+  results_.clearWakeup();
+}
+
+/**
+ * \fn ContentHasher::run
+ *
+ * Runs one job in the calling thread. Errors are reported in job.ok; 
+ * a failed hash job still carries a content hash, so the file can be 
+ * announced and is rejected by its receivers. 
+ */
+void ContentHasher::run(hash_job_t& job) {
+  job.ok = false;
+  try {
+    if (job.kind == hash_job_t::hash) {
+      File file(job.box_dir, job.box_hash);
+      std::istringstream record(job.record);
+      PathCodec codec;
+      file.deserialize(record, codec);
+      file.prepareAnnouncement(job.max_holes);
+      job.holes = file.getAnnouncedHoles();
+      std::memcpy(job.content_hash, file.getAnnouncedContentHash(), F_GENERIC_HASH_LEN);
+      job.ok = true;
+    } else {
+      job.file->setHoles(job.holes);
+      job.file->getSignature(job.signature, job.content_hash);
+      job.ok = std::memcmp(job.content_hash, job.journal->getContentHash(),
+                           F_GENERIC_HASH_LEN) == 0;
+      // its chunks can be referenced by later transfers
+      if (job.ok) job.file->indexChunks();
+      job.file->closeFile();
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "[E] Hashing failed: " << e.what() << std::endl;
+    if (job.kind == hash_job_t::hash)
+      crypto_generichash(job.content_hash, F_GENERIC_HASH_LEN, NULL, 0, NULL, 0);
+  }
+}
+
+void ContentHasher::work() {
+  struct pollfd request = { requests_.fd(), POLLIN, 0 };
+  while (true) {
+    if (::poll(&request, 1, -1) < 0 && errno != EINTR) {
+      stopped_ = true;
+      return;
+    }
+    requests_.clearWakeup();
+
+    hash_job_t* job;
+    while (requests_.pop(job)) {
+      if (job == nullptr) {
+        stopped_ = true;
+        return;
+      }
+      if (!job->cancelled.load()) run(*job);
+      while (!results_.push(std::move(job)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
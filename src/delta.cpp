@@ -0,0 +1,421 @@
+/**
+ * \file      delta.cpp
+ * \brief     Block signatures and delta encoding of modified files. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "delta.hpp"
+
+#include <unistd.h>
+#include <endian.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <boost/filesystem.hpp>
+
+#include "hash.hpp"
+
+namespace {
+  const char     signature_magic[4] = { 'F', 'L', 'S', '1' };
+  const uint64_t signature_header_size = 4 + 8 + 4 + 4 + F_GENERIC_HASH_LEN + 8;
+}
+
+Signature::Signature() :
+  size_(0),
+  mtime_(0),
+  block_size_(F_DELTA_MINIMUM_BLOCK_SIZE),
+  weak_(),
+  strong_(),
+  content_hash_(),
+  state_(),
+  block_() {}
+
+/**
+ * \fn Signature::getBlockSize
+ *
+ * Like rsync, the block size grows with the square root of the file 
+ * size, so the number of blocks of large files stays manageable. 
+ */
+uint64_t Signature::getBlockSize(const uint64_t size) {
+  uint64_t block_size = F_DELTA_MINIMUM_BLOCK_SIZE;
+  while (block_size < F_DELTA_MAXIMUM_BLOCK_SIZE && block_size * block_size < size)
+    block_size <<= 1;
+  return block_size;
+}
+
+/**
+ * \fn Signature::weakChecksum
+ *
+ * The rolling checksum of rsync: the low half is the sum of all bytes, 
+ * the high half the sum of these sums, both modulo 2^16. 
+ */
+uint32_t Signature::weakChecksum(const unsigned char* data, const uint64_t length) {
+  uint32_t a = 0, b = 0;
+  for (uint64_t i = 0; i < length; ++i) {
+    a += data[i];
+    b += static_cast<uint32_t>(length - i) * data[i];
+  }
+  return (a & 0xffff) | ((b & 0xffff) << 16);
+}
+uint32_t Signature::rollChecksum(const uint32_t checksum,
+                                 const unsigned char out,
+                                 const unsigned char in,
+                                 const uint64_t length) {
+  uint32_t a = checksum & 0xffff;
+  uint32_t b = checksum >> 16;
+  a = (a - out + in) & 0xffff;
+  b = (b - static_cast<uint32_t>(length) * out + a) & 0xffff;
+  return a | (b << 16);
+}
+void Signature::strongHash(const unsigned char* data,
+                           const uint64_t length,
+                           unsigned char hash[F_DELTA_STRONG_HASH_LEN]) {
+  crypto_generichash(hash, F_DELTA_STRONG_HASH_LEN, data, length, NULL, 0);
+}
+
+const std::string Signature::getSignaturePath(const std::string& journal_dir,
+                                              const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                                              const std::string& path) {
+  // signatures are named after the box and the path of the file
+  std::string key(reinterpret_cast<const char*>(box_hash), F_GENERIC_HASH_LEN);
+  key += path;
+  boost::filesystem::path dir(journal_dir);
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(dir, ec);
+  return (dir / (Hash(key).getString() + ".sig")).string();
+}
+
+void Signature::begin(const uint64_t size, const uint32_t mtime) {
+  size_ = 0;
+  mtime_ = mtime;
+  block_size_ = getBlockSize(size);
+  weak_.clear();
+  weak_.reserve((size + block_size_ - 1) / block_size_);
+  strong_.clear();
+  strong_.reserve(weak_.capacity() * F_DELTA_STRONG_HASH_LEN);
+  block_.clear();
+  block_.reserve(block_size_);
+  crypto_generichash_init(&state_, NULL, 0, F_GENERIC_HASH_LEN);
+}
+void Signature::update(const unsigned char* data, uint64_t length) {
+  crypto_generichash_update(&state_, data, length);
+  size_ += length;
+  while (length > 0) {
+    uint64_t take = std::min<uint64_t>(length, block_size_ - block_.size());
+    block_.insert(block_.end(), data, data + take);
+    data += take;
+    length -= take;
+    if (block_.size() == block_size_) {
+      weak_.push_back(weakChecksum(block_.data(), block_.size()));
+      strong_.resize(strong_.size() + F_DELTA_STRONG_HASH_LEN);
+      strongHash(block_.data(), block_.size(), &strong_[strong_.size() - F_DELTA_STRONG_HASH_LEN]);
+      block_.clear();
+    }
+  }
+}
+void Signature::finish() {
+  if (!block_.empty()) {
+    weak_.push_back(weakChecksum(block_.data(), block_.size()));
+    strong_.resize(strong_.size() + F_DELTA_STRONG_HASH_LEN);
+    strongHash(block_.data(), block_.size(), &strong_[strong_.size() - F_DELTA_STRONG_HASH_LEN]);
+    block_.clear();
+  }
+  crypto_generichash_final(&state_, content_hash_, F_GENERIC_HASH_LEN);
+}
+
+bool Signature::load(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+
+  char header[signature_header_size];
+  if (!in.read(header, signature_header_size)
+   || std::memcmp(header, signature_magic, 4) != 0) return false;
+  uint64_t size, count;
+  uint32_t mtime, block_size;
+  std::memcpy(&size, header + 4, 8);
+  std::memcpy(&mtime, header + 12, 4);
+  std::memcpy(&block_size, header + 16, 4);
+  std::memcpy(content_hash_, header + 20, F_GENERIC_HASH_LEN);
+  std::memcpy(&count, header + 20 + F_GENERIC_HASH_LEN, 8);
+  size_ = be64toh(size);
+  mtime_ = be32toh(mtime);
+  block_size_ = be32toh(block_size);
+  count = be64toh(count);
+  if (block_size_ == 0 || count != (size_ + block_size_ - 1) / block_size_) return false;
+
+  weak_.resize(count);
+  strong_.resize(count * F_DELTA_STRONG_HASH_LEN);
+  if (!in.read(reinterpret_cast<char*>(weak_.data()), count * 4)
+   || !in.read(reinterpret_cast<char*>(strong_.data()), strong_.size())) return false;
+  for (uint64_t i = 0; i < count; ++i)
+    weak_[i] = be32toh(weak_[i]);
+  return true;
+}
+
+/**
+ * \fn Signature::save
+ *
+ * Writes the signature to a temporary file first, so a crash never 
+ * leaves a truncated signature behind. 
+ */
+bool Signature::save(const std::string& path) const {
+  std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    char header[signature_header_size];
+    uint64_t size_be = htobe64(size_);
+    uint32_t mtime_be = htobe32(mtime_);
+    uint32_t block_size_be = htobe32(static_cast<uint32_t>(block_size_));
+    uint64_t count_be = htobe64(weak_.size());
+    std::memcpy(header, signature_magic, 4);
+    std::memcpy(header + 4, &size_be, 8);
+    std::memcpy(header + 12, &mtime_be, 4);
+    std::memcpy(header + 16, &block_size_be, 4);
+    std::memcpy(header + 20, content_hash_, F_GENERIC_HASH_LEN);
+    std::memcpy(header + 20 + F_GENERIC_HASH_LEN, &count_be, 8);
+    out.write(header, signature_header_size);
+
+    std::vector<uint32_t> weak_be(weak_.size());
+    for (uint64_t i = 0; i < weak_.size(); ++i)
+      weak_be[i] = htobe32(weak_[i]);
+    out.write(reinterpret_cast<const char*>(weak_be.data()), weak_be.size() * 4);
+    out.write(reinterpret_cast<const char*>(strong_.data()), strong_.size());
+    if (!out) return false;
+  }
+  boost::system::error_code ec;
+  boost::filesystem::rename(tmp_path, path, ec);
+  return !ec;
+}
+
+bool Signature::matches(const uint64_t size, const uint32_t mtime) const {
+  return size_ == size && mtime_ == mtime;
+}
+uint64_t Signature::getSize() const {
+  return size_;
+}
+uint32_t Signature::getMtime() const {
+  return mtime_;
+}
+uint64_t Signature::getBlockSize() const {
+  return block_size_;
+}
+uint64_t Signature::getBlockCount() const {
+  return weak_.size();
+}
+uint64_t Signature::getBlockLength(const uint64_t index) const {
+  if (index + 1 < weak_.size()) return block_size_;
+  return size_ - index * block_size_;
+}
+uint32_t Signature::getWeak(const uint64_t index) const {
+  return weak_[index];
+}
+const unsigned char* Signature::getStrong(const uint64_t index) const {
+  return &strong_[index * F_DELTA_STRONG_HASH_LEN];
+}
+const unsigned char* Signature::getContentHash() const {
+  return content_hash_;
+}
+
+DeltaEncoder::DeltaEncoder(const int fd,
+                           const uint64_t size,
+                           const uint32_t mtime,
+                           const Signature& base,
+                           const bool in_place,
+                           Prefetcher* prefetcher) :
+  fd_(fd),
+  prefetcher_(prefetcher),
+  size_(size),
+  base_(base),
+  in_place_(in_place),
+  signature_(),
+  index_(),
+  buffer_(F_MAXIMUM_FILE_PACKAGE_SIZE + 2 * base.getBlockSize() + F_CONTENT_HASH_BLOCK_SIZE),
+  buffer_offset_(0),
+  buffer_length_(0),
+  pos_(0),
+  literal_start_(0),
+  weak_(0),
+  weak_valid_(false),
+  has_copy_(false),
+  copy_(),
+  queue_(),
+  done_(false) {
+  index_.reserve(base_.getBlockCount());
+  for (uint64_t i = 0; i < base_.getBlockCount(); ++i)
+    index_.insert(std::make_pair(base_.getWeak(i), i));
+  signature_.begin(size_, mtime);
+}
+
+/**
+ * \fn DeltaEncoder::next
+ *
+ * Returns the next instruction or false once the whole file has been 
+ * encoded. Literals are at most F_MAXIMUM_FILE_PACKAGE_SIZE bytes long. 
+ */
+bool DeltaEncoder::next(DeltaInstruction& instruction) {
+  const uint64_t block_size = base_.getBlockSize();
+
+  while (queue_.empty() && !done_) {
+    uint64_t remaining = size_ - pos_;
+    if (remaining == 0) {
+      pushLiteral();
+      pushCopy();
+      signature_.finish();
+      done_ = true;
+      break;
+    }
+
+    uint64_t length = std::min(remaining, block_size);
+    if (!fill(pos_ + length)) {
+      // the file shrank while we were reading it
+      size_ = buffer_offset_ + buffer_length_;
+      weak_valid_ = false;
+      continue;
+    }
+
+    // only the last block of the old version may be shorter
+    bool tail = length < block_size;
+    if ( !tail
+      || (base_.getBlockCount() > 0
+          && base_.getBlockLength(base_.getBlockCount() - 1) == length) ) {
+      if (!weak_valid_) {
+        weak_ = Signature::weakChecksum(&buffer_[pos_ - buffer_offset_], length);
+        weak_valid_ = true;
+      }
+      uint64_t source;
+      if (findBlock(length, source)) {
+        pushLiteral();
+        if ( has_copy_
+          && copy_.offset + copy_.length == pos_
+          && copy_.source + copy_.length == source ) {
+          copy_.length += length;
+        } else {
+          pushCopy();
+          has_copy_ = true;
+          copy_.op = DeltaInstruction::copy;
+          copy_.offset = pos_;
+          copy_.source = source;
+          copy_.length = length;
+        }
+        pos_ += length;
+        literal_start_ = pos_;
+        weak_valid_ = false;
+        continue;
+      }
+    }
+
+    if (tail) {
+      // nothing in the rest of the file can match anymore
+      pos_ += std::min(remaining, F_MAXIMUM_FILE_PACKAGE_SIZE - (pos_ - literal_start_));
+      weak_valid_ = false;
+    } else {
+      if (pos_ + length < size_ && fill(pos_ + length + 1)) {
+        weak_ = Signature::rollChecksum(weak_,
+                                        buffer_[pos_ - buffer_offset_],
+                                        buffer_[pos_ + length - buffer_offset_],
+                                        length);
+      } else {
+        weak_valid_ = false;
+      }
+      ++pos_;
+    }
+    if (pos_ - literal_start_ >= F_MAXIMUM_FILE_PACKAGE_SIZE)
+      pushLiteral();
+  }
+
+  if (queue_.empty()) return false;
+  instruction = queue_.front();
+  queue_.pop_front();
+  return true;
+}
+
+const Signature& DeltaEncoder::getSignature() const {
+  return signature_;
+}
+
+/**
+ * \fn DeltaEncoder::fill
+ *
+ * Makes sure the buffer holds everything from the start of the pending 
+ * literal up to end. Every byte is read exactly once and also fed into 
+ * the signature of the new version. 
+ */
+bool DeltaEncoder::fill(const uint64_t end) {
+  if (end <= buffer_offset_ + buffer_length_) return true;
+
+  uint64_t drop = literal_start_ - buffer_offset_;
+  std::memmove(buffer_.data(), buffer_.data() + drop, buffer_length_ - drop);
+  buffer_offset_ = literal_start_;
+  buffer_length_ -= drop;
+
+  while (buffer_offset_ + buffer_length_ < end) {
+    uint64_t want = std::min<uint64_t>(buffer_.size() - buffer_length_,
+                                       size_ - (buffer_offset_ + buffer_length_));
+    if (want == 0) break;
+    off_t offset = static_cast<off_t>(buffer_offset_ + buffer_length_);
+    ssize_t r = prefetcher_ != nullptr
+              ? prefetcher_->read(buffer_.data() + buffer_length_, want, offset)
+              : ::pread(fd_, buffer_.data() + buffer_length_, want, offset);
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) break;
+    signature_.update(buffer_.data() + buffer_length_, r);
+    buffer_length_ += r;
+  }
+  return end <= buffer_offset_ + buffer_length_;
+}
+
+bool DeltaEncoder::findBlock(const uint64_t length, uint64_t& source) {
+  typedef std::unordered_multimap<uint32_t, uint64_t>::const_iterator index_iter;
+  std::pair<index_iter, index_iter> candidates = index_.equal_range(weak_);
+  if (candidates.first == candidates.second) return false;
+
+  unsigned char strong[F_DELTA_STRONG_HASH_LEN];
+  bool hashed = false;
+  bool found = false;
+  for (index_iter i = candidates.first; i != candidates.second; ++i) {
+    uint64_t offset = i->second * base_.getBlockSize();
+    if (base_.getBlockLength(i->second) != length) continue;
+    // in place, a block behind us has already been overwritten
+    if (in_place_ && offset < pos_) continue;
+    if (!hashed) {
+      Signature::strongHash(&buffer_[pos_ - buffer_offset_], length, strong);
+      hashed = true;
+    }
+    if (std::memcmp(strong, base_.getStrong(i->second), F_DELTA_STRONG_HASH_LEN) != 0)
+      continue;
+    if (!found || offset == pos_) {
+      source = offset;
+      found = true;
+    }
+    // continuing the current copy is best
+    if (has_copy_ && offset == copy_.source + copy_.length) {
+      source = offset;
+      break;
+    }
+  }
+  return found;
+}
+
+void DeltaEncoder::pushCopy() {
+  if (!has_copy_) return;
+  queue_.push_back(copy_);
+  has_copy_ = false;
+}
+
+void DeltaEncoder::pushLiteral() {
+  if (pos_ == literal_start_) return;
+  pushCopy();
+  DeltaInstruction literal;
+  literal.op = DeltaInstruction::literal;
+  literal.offset = literal_start_;
+  literal.source = 0;
+  literal.length = pos_ - literal_start_;
+  literal.data.assign(reinterpret_cast<const char*>(&buffer_[literal_start_ - buffer_offset_]),
+                      literal.length);
+  queue_.push_back(literal);
+  literal_start_ = pos_;
+}
@@ -5,12 +5,21 @@
 #include "constants.hpp"
 #include "dispatcher.hpp"
 #include "file.hpp"
+#include "config.hpp"
+#include "delta.hpp"
+#include "chunker.hpp"
+#include "compression.hpp"
+#include "message_schema.hpp"
 
 #include <unistd.h>
+#include <fcntl.h>
 #include <endian.h>
 
 #include <zmqpp/zmqpp.hpp>
 #include <string>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
@@ -18,41 +27,52 @@
 #include <chrono>
 #include <thread>
 
-Dispatcher::Dispatcher(zmqpp::context* z_ctx_, fsm::status_t status) :
+Dispatcher::Dispatcher(zmqpp::context* z_ctx_,
+                       fsm::status_t status,
+                       const unsigned char box_hash[F_GENERIC_HASH_LEN]) :
   Transmitter(z_ctx_),
-  z_dispatcher(nullptr),
-  z_boxoffice_disp_push(nullptr),
+  pub_disp_channels(),
+  bo_disp_channel(nullptr),
+  lane_(0),
+  deferred_(),
+  held_(),
+  z_msg_(),
   current_status_(status),
   timing_offset_(-1),
-  waiting_for_stop_(false) {
+  timing_deadline_(0),
+  waiting_for_stop_(false),
+  compression_(Config::getInstance()->getCompression()),
+  literals_(),
+  literals_offset_(0),
+  has_pending_(false),
+  pending_offset_(0),
+  pending_length_(0),
+  pending_op_(DeltaInstruction::literal),
+  pending_data_(),
+  packed_(),
+  read_buffer_(F_COMPRESSION_MAXIMUM_INPUT) {
     tac = (char*)"dis";
+    std::memcpy(box_hash_, box_hash, F_GENERIC_HASH_LEN);
     this->connectToBoxofficeDispatcher();
     this->connectToPublisher();
 }
 
-Dispatcher::~Dispatcher() {
-  z_boxoffice_disp_push->close();
-  z_dispatcher->close();
-
-  delete z_boxoffice_disp_push;
-  delete z_dispatcher;
-}
+Dispatcher::~Dispatcher() {}
 
 int Dispatcher::connectToPublisher()
 {
-  // connect to process broadcast
-  z_dispatcher = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pair);
-  z_dispatcher->bind("inproc://pub_disp_pair");
+  // one for the publisher of every host
+  std::vector<host_t> hosts = Config::getInstance()->getHosts();
+  for (std::vector<host_t>::iterator i = hosts.begin(); i != hosts.end(); ++i)
+    pub_disp_channels.push_back(s_channel("pub_disp" + i->endpoint, box_hash_));
 
   return 0;
 }
 
 int Dispatcher::connectToBoxofficeDispatcher()
 {
-  // open connection to receive HB data from boxoffice
-  z_boxoffice_disp_push = new zmqpp::socket(*z_ctx, zmqpp::socket_type::sub);
-  z_boxoffice_disp_push->connect("inproc://f_boxoffice_disp_push_out");
-  z_boxoffice_disp_push->subscribe("");
+  // receives FSM updates from boxoffice
+  bo_disp_channel = s_channel("bo_disp", box_hash_);
 
   return 0;
 }
@@ -65,190 +85,512 @@ int Dispatcher::run()
 
   if (F_MSG_DEBUG) printf("dis: starting disp socket and sending...\n");
 
-  std::stringstream* sstream;
-  int msg_type, msg_signal;
+  FrameView frame;
+  Reactor reactor;
+  reactor.add(*z_broadcast);
+  reactor.add(*z_boxoffice_push);
+  reactor.add(*bo_disp_channel);
 
   while(true)
   {
-    // waiting for boxoffice input in non-blocking mode
-    sstream = new std::stringstream();
-    s_recv(*z_boxoffice_push, *z_boxoffice_disp_push, *z_broadcast, *sstream);
-
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type == F_SIGTYPE_LIFE && msg_signal == F_SIGLIFE_INTERRUPT ) break;
-    if ( msg_type == F_SIGTYPE_FSM ) {
-      current_status_ = (fsm::status_t)msg_signal;
+    // waiting for boxoffice input
+    receive(reactor, frame, zmqpp::poller::wait_forever, true);
+
+    if ( !frame.valid() ) continue;
+    if ( frame.type() == F_SIGTYPE_LIFE && frame.status() == F_SIGLIFE_INTERRUPT ) break;
+    if ( frame.type() == F_SIGTYPE_FSM ) {
+      current_status_ = (fsm::status_t)frame.status();
     }
 
     if (F_MSG_DEBUG) printf("dis: sending file data status %d\n", (int)current_status_);
 
     if ( current_status_ == fsm::status_122
       || current_status_ == fsm::status_177 ) {
-      uint64_t timing_offset;
-      char* timing_offset_c = new char[8];
-      sstream->seekg(1, std::ios_base::cur);
-      sstream->read(timing_offset_c, 8);
-      std::memcpy(&timing_offset, timing_offset_c, 8);
       uint64_t timestamp =
         std::chrono::duration_cast< std::chrono::milliseconds >(
           std::chrono::system_clock::now().time_since_epoch()
         ).count();
-      timing_offset_ = be64toh(timing_offset) - timestamp;
+      lane_ = frame.lane();
+      timing_deadline_ = frame.timestamp();
+      // a lane that waited for another one may be past its deadline
+      timing_offset_ = timing_deadline_ > timestamp ? timing_deadline_ - timestamp : 0;
+
+      unsigned char box_hash[F_GENERIC_HASH_LEN];
+      std::memcpy(box_hash, frame.box(), F_GENERIC_HASH_LEN);
+      msg::DispatchFile dispatch;
+      if ( !dispatch.decode(frame) ) continue;
+      std::string box_dir(dispatch.box_dir, dispatch.box_dir_length);
+
+      Hash hash(box_hash);
+      File file(box_dir, &hash);
+      MemoryInputStream record(dispatch.record, dispatch.record_length);
+      record >> file;
 
 // \TODO needs individual offset
       std::this_thread::sleep_for(std::chrono::milliseconds(timing_offset_));
       if (F_MSG_DEBUG) printf("dis: time's up!\n");
 
-      std::stringstream* message = new std::stringstream();
-      *message << F_SIGTYPE_FSM  << " "
-               << fsm::status_132;
-      zmqpp::message* z_msg = new zmqpp::message();
-      *z_msg << message->str();
-      z_boxoffice_pull->send(*z_msg);
-      delete message;
-      message = new std::stringstream();
-      delete z_msg;
-      z_msg = new zmqpp::message();
+      s_send(*z_boxoffice_pull, Frame(F_SIGTYPE_FSM, fsm::status_132).setBox(box_hash_)
+                                                                      .setLane(lane_));
 
       std::this_thread::sleep_for(std::chrono::milliseconds(250));
 
       current_status_ = fsm::status_200;
 
-      char box_hash_s[F_GENERIC_HASH_LEN];
-      sstream->read(box_hash_s, F_GENERIC_HASH_LEN);
-      unsigned char box_hash[F_GENERIC_HASH_LEN];
-      std::memcpy(box_hash, box_hash_s, F_GENERIC_HASH_LEN);
-      Hash* hash = new Hash(box_hash);
-      std::string box_dir;
-      *sstream >> box_dir;
-
-      File* file = new File(box_dir, hash);
-      sstream->seekg(1, std::ios_base::cur);
-      *sstream >> *file;
-
-      char* contents = new char[F_MAXIMUM_FILE_PACKAGE_SIZE];
-      bool* more = new bool(true);
-      uint64_t data_size = 0;
-      uint64_t offset = 0;
-
-      message = new std::stringstream();
-      *message << F_SIGTYPE_PUB  << " "
-               << std::to_string(current_status_);
-      z_msg = new zmqpp::message();
-
-      while (*more) {
-        data_size += file->readFileData(contents,
-                                        F_MAXIMUM_FILE_PACKAGE_SIZE,
-                                        offset,
-                                        more);
-
-        uint64_t offset_be = htobe64(offset);
-        char* offset_c = new char[8];
-        std::memcpy(offset_c, &offset_be, 8);
-        message->write(offset_c, 8);
-
-        offset += F_MAXIMUM_FILE_PACKAGE_SIZE;
-
-        uint64_t data_size_be = htobe64(data_size);
-        char* data_size_c = new char[8];
-        std::memcpy(data_size_c, &data_size_be, 8);
-        message->write(data_size_c, 8);
-
-        int8_t more_i = static_cast<int8_t>(*more);
-        char* more_c = new char[1];
-        std::memcpy(more_c, &more_i, 1);
-        message->write(more_c, 1);
-
-        message->write(contents, data_size);
-
-        int p = message->tellp();
-        if (F_MAXIMUM_FILE_PACKAGE_SIZE+22-p > 0)
-          *message << std::setw(F_MAXIMUM_FILE_PACKAGE_SIZE+22-p)
-                   << std::setfill(' ') << " ";
-
-        *z_msg << message->str();
-        z_dispatcher->send(*z_msg);
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(250));
-
-        delete contents;
-        contents = new char[F_MAXIMUM_FILE_PACKAGE_SIZE];
-        delete message;
-        message = new std::stringstream();
-        delete z_msg;
-        z_msg = new zmqpp::message();
+      // receivers that already have parts of the file only ask for
+      // the missing ranges, receivers with an older version of it for
+      // a delta against that version
+      std::vector< std::pair<uint64_t, uint64_t> > ranges;
+      std::string delta_base;
+      bool delta_in_place = false;
+      int resume = receiveResumeRanges(reactor, ranges, delta_base, delta_in_place);
+      if (resume < 0) return 0;
+
+      std::string signature_path = Signature::getSignaturePath(
+        Config::getInstance()->getJournalDir(), box_hash, file.getPath());
+      Signature base;
+      Signature signature;
+      bool delta = !delta_base.empty()
+                && base.load(signature_path)
+                && Hash(base.getContentHash()).getString() == delta_base;
+
+      if (delta) {
+        sendDelta(box_dir, &file, base, delta_in_place, signature);
+      } else if (resume == 0) {
+        sendChunks(box_dir, &file, signature);
+      } else {
+        sendRanges(&file, ranges);
+        file.getSignature(signature);
       }
-
-      delete message;
-      delete z_msg;
-      delete contents;
+      // kept as the base of the next delta of this file
+      signature.save(signature_path);
+      file.closeFile();
 
       current_status_ = fsm::status_210;
-      int retval = synchronizingStop();
+      int retval = synchronizingStop(reactor);
       if (retval == 0) return retval;
 
     } else if (current_status_ == fsm::status_130) {
       if (F_MSG_DEBUG) printf("dis: sending fake file data status %d\n", (int)current_status_);
-      uint64_t timing_offset;
-      char* timing_offset_c = new char[8];
-      sstream->seekg(1, std::ios_base::cur);
-      sstream->read(timing_offset_c, 8);
-      std::memcpy(&timing_offset, timing_offset_c, 8);
       uint64_t timestamp =
         std::chrono::duration_cast< std::chrono::milliseconds >(
           std::chrono::system_clock::now().time_since_epoch()
         ).count();
-      timing_offset_ = be64toh(timing_offset) - timestamp;
+      lane_ = frame.lane();
+      timing_offset_ = frame.timestamp() > timestamp ? frame.timestamp() - timestamp : 0;
 
 // \TODO needs individual offset
       std::this_thread::sleep_for(std::chrono::milliseconds(timing_offset_));
       if (F_MSG_DEBUG) printf("dis: time's up!\n");
 
-      std::stringstream* message = new std::stringstream();
-      *message << F_SIGTYPE_FSM  << " "
-               << std::to_string(fsm::status_132);
-      zmqpp::message* z_msg = new zmqpp::message();
-      *z_msg << message->str();
-      z_boxoffice_pull->send(*z_msg);
-      delete message;
-      delete z_msg;
+      s_send(*z_boxoffice_pull, Frame(F_SIGTYPE_FSM, fsm::status_132).setBox(box_hash_)
+                                                                      .setLane(lane_));
 
       std::this_thread::sleep_for(std::chrono::milliseconds(250));
 
       current_status_ = fsm::status_210;
-      int retval = synchronizingStop();
+      int retval = synchronizingStop(reactor);
       if (retval == 0) return retval;
     }
 
   }
 
-  delete sstream;
-
   return 0;
 }
 
-int Dispatcher::synchronizingStop() {
+/**
+ * Takes the next frame for the dispatcher; -1 if nothing came within 
+ * timeout ms. During a transfer only frames of its lane are taken, FSM 
+ * frames of other lanes are put aside. Once the dispatcher is idle 
+ * again, the frames put aside come first, in the order they came in. 
+ */
+int Dispatcher::receive(Reactor& reactor,
+                        FrameView& frame,
+                        const long timeout,
+                        const bool any_lane) {
+  for (std::deque<Frame>::iterator i = deferred_.begin(); i != deferred_.end(); ++i) {
+    if ( !any_lane && FrameView(i->data(), i->size()).lane() != lane_ ) continue;
+    held_ = std::move(*i);
+    deferred_.erase(i);
+    frame = FrameView(held_.data(), held_.size());
+    return 0;
+  }
+
+  while (true) {
+    int source = reactor.receive(z_msg_, frame, timeout);
+    if ( source < 0 || any_lane || !frame.valid()
+      || frame.type() != F_SIGTYPE_FSM || frame.lane() == lane_ ) return source;
+    deferred_.emplace_back(frame);
+  }
+}
+
+/**
+ * Collects the ranges or the delta base the boxoffice forwarded from 
+ * the receivers while the dispatcher waited for the timing offset. 
+ * Returns 1 if ranges or a delta base were received, 0 if the whole 
+ * file has to be sent and -1 on interrupt. 
+ */
+int Dispatcher::receiveResumeRanges(Reactor& reactor,
+                                    std::vector< std::pair<uint64_t, uint64_t> >& ranges,
+                                    std::string& delta_base,
+                                    bool& delta_in_place) {
+  int return_val = 0;
+  FrameView frame;
   while (true) {
-    std::stringstream* sstream = new std::stringstream();
-    int msg_type, msg_signal;
-    int z_return = s_recv_noblock(*z_boxoffice_push,
-                                  *z_boxoffice_disp_push,
-                                  *z_broadcast,
-                                  *sstream,
-                                  250);
-    if ( z_return != 0 ) {
-      *sstream >> msg_type >> msg_signal;
-      if ( msg_type == F_SIGTYPE_LIFE && msg_signal == F_SIGLIFE_INTERRUPT ) {
-        delete sstream;
+    if ( receive(reactor, frame, 0, false) < 0 ) break;
+
+    if ( !frame.valid() ) continue;
+    if ( frame.type() == F_SIGTYPE_LIFE && frame.status() == F_SIGLIFE_INTERRUPT ) return -1;
+    if ( frame.type() != F_SIGTYPE_FSM || frame.status() != fsm::status_131 ) continue;
+
+    // ranges of an earlier transfer are ignored
+    msg::ResumeReply reply;
+    if ( frame.timestamp() != timing_deadline_
+      || !msg::decode<fsm::status_131>(frame, reply) ) continue;
+
+    if (reply.tag == 'D') {
+      delta_base = Hash(reply.base).getString();
+      delta_in_place = reply.in_place;
+      ranges.clear();
+      return_val = 1;
+    } else if (reply.tag == 'R') {
+      delta_base.clear();
+      ranges = reply.ranges;
+      return_val = 1;
+    }
+  }
+  return return_val;
+}
+
+/**
+ * Sends the given ranges of the file. Parts of them that are holes in 
+ * the file are only announced, so the receivers punch them instead of 
+ * storing zeros. If no ranges are left, a single empty package 
+ * concludes the transfer. 
+ */
+void Dispatcher::sendRanges(File* file,
+                            const std::vector< std::pair<uint64_t, uint64_t> >& ranges) {
+  std::vector< std::pair<uint64_t, uint64_t> > data = file->getDataRanges();
+
+  // the parts of the ranges with data, in the order they are sent
+  std::vector< std::pair<uint64_t, uint64_t> > reads;
+  std::vector< std::pair<uint64_t, uint64_t> >::const_iterator extent = data.begin();
+  for (std::vector< std::pair<uint64_t, uint64_t> >::const_iterator range = ranges.begin();
+       range != ranges.end(); ++range) {
+    while (extent != data.end() && extent->second <= range->first) ++extent;
+    for (std::vector< std::pair<uint64_t, uint64_t> >::const_iterator i = extent;
+         i != data.end() && i->first < range->second; ++i) {
+      reads.push_back(std::make_pair(std::max(i->first, range->first),
+                                     std::min(i->second, range->second)));
+    }
+  }
+  Prefetcher prefetcher(file->getFileDescriptor(), reads);
+
+  uint64_t offset = 0;
+  std::vector< std::pair<uint64_t, uint64_t> >::const_iterator read = reads.begin();
+  for (std::vector< std::pair<uint64_t, uint64_t> >::const_iterator range = ranges.begin();
+       range != ranges.end(); ++range) {
+    offset = range->first;
+    for (; read != reads.end() && read->first < range->second; ++read) {
+      if (read->first > offset) queueHole(offset, read->first - offset);
+      queueData(prefetcher, read->first, read->second);
+      offset = read->second;
+    }
+    if (offset < range->second) queueHole(offset, range->second - offset);
+  }
+  flushPackages();
+}
+
+/**
+ * Queues the file data between offset and end as literals. 
+ */
+void Dispatcher::queueData(Prefetcher& prefetcher, uint64_t offset, const uint64_t end) {
+  std::vector<char>& contents = read_buffer_;
+  while (offset < end) {
+    // read as much as a compressed package may carry
+    uint64_t length = 0;
+    while (length < contents.size() && offset + length < end) {
+      ssize_t r = prefetcher.read(contents.data() + length,
+                                  std::min<uint64_t>(contents.size() - length,
+                                                     end - offset - length),
+                                  offset + length);
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) break;
+      length += r;
+    }
+    if (length == 0) break;
+    queueLiteral(offset, contents.data(), length);
+    offset += length;
+  }
+}
+
+/**
+ * Queues a hole of the file. Receivers punch it, so it reads back as 
+ * zeros. 
+ */
+void Dispatcher::queueHole(const uint64_t offset, const uint64_t length) {
+  // packed_ is empty between packages and keeps its capacity
+  queuePackage(offset, length, DeltaInstruction::hole, packed_);
+}
+
+/**
+ * Sends the file as a delta against the version the receivers have: 
+ * copies of blocks they already have and literal data for the rest. 
+ * The signature of the sent version is built along the way. 
+ */
+void Dispatcher::sendDelta(const std::string& box_dir,
+                           File* file,
+                           const Signature& base,
+                           const bool in_place,
+                           Signature& signature) {
+  boost::filesystem::path path = boost::filesystem::path(box_dir) / file->getPath();
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    sendRanges(file, std::vector< std::pair<uint64_t, uint64_t> >(
+                       1, std::make_pair(0, file->getSize())));
+    file->getSignature(signature);
+    return;
+  }
+
+  Prefetcher prefetcher(fd, std::vector< std::pair<uint64_t, uint64_t> >(
+                              1, std::make_pair(0, file->getSize())));
+  DeltaEncoder encoder(fd, file->getSize(), file->getMtime(), base, in_place, &prefetcher);
+  DeltaInstruction instruction;
+  while (encoder.next(instruction)) {
+    if (instruction.op == DeltaInstruction::copy) {
+      msg::CopySource copy = { instruction.source };
+      char buffer[msg::CopySource::fixed_size];
+      copy.encode(buffer);
+      std::string source(buffer, sizeof(buffer));
+      queuePackage(instruction.offset, instruction.length,
+                   DeltaInstruction::copy, source);
+    } else {
+      queueLiteral(instruction.offset, instruction.data.data(), instruction.length);
+    }
+  }
+  flushPackages();
+  prefetcher.stop();
+  ::close(fd);
+
+  signature = encoder.getSignature();
+}
+
+/**
+ * Sends the whole file split into content-defined chunks. Chunks the 
+ * ChunkStore knows, i.e. chunks of any synced file, and chunks already 
+ * sent in this transfer are only referenced, up to 
+ * F_MAXIMUM_FILE_PACKAGE_SIZE / F_CHUNK_REFERENCE_LEN references per 
+ * package. All other chunks are sent as literal data, holes of sparse 
+ * files only as their range. Receivers that cannot resolve a reference 
+ * request the chunk again afterwards. The signature of the sent 
+ * version and the chunk index are updated along the way. 
+ */
+void Dispatcher::sendChunks(const std::string& box_dir,
+                            File* file,
+                            Signature& signature) {
+  boost::filesystem::path path = boost::filesystem::path(box_dir) / file->getPath();
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    sendRanges(file, std::vector< std::pair<uint64_t, uint64_t> >(
+                       1, std::make_pair(0, file->getSize())));
+    file->getSignature(signature);
+    return;
+  }
+
+  ChunkStore* store = ChunkStore::getInstance();
+  const size_t references_per_package = F_MAXIMUM_FILE_PACKAGE_SIZE / F_CHUNK_REFERENCE_LEN;
+  std::unordered_map<std::string, uint64_t> sent;
+  std::vector<Chunk> chunks;
+  std::string references;
+  size_t reference_count = 0;
+  const std::vector<unsigned char> zeros(F_CONTENT_HASH_BLOCK_SIZE, 0);
+
+  signature.begin(file->getSize(), file->getMtime());
+  std::vector< std::pair<uint64_t, uint64_t> > data = file->getDataRanges();
+  Prefetcher prefetcher(fd, data);
+  uint64_t offset = 0;
+  for (size_t i = 0; i <= data.size(); ++i) {
+    // the hole in front of this extent, or behind the last one
+    uint64_t hole_end = (i == data.size()) ? file->getSize() : data[i].first;
+    if (hole_end > offset) {
+      queueHole(offset, hole_end - offset);
+      for (uint64_t zero = offset; zero < hole_end; zero += zeros.size())
+        signature.update(zeros.data(), std::min<uint64_t>(hole_end - zero, zeros.size()));
+    }
+    if (i == data.size()) break;
+
+    Chunker chunker(fd, data[i].second, data[i].first, &prefetcher);
+    Chunk chunk;
+    const unsigned char* chunk_data;
+    while (chunker.next(chunk, &chunk_data)) {
+      signature.update(chunk_data, chunk.length);
+      chunks.push_back(chunk);
+
+      std::string key(reinterpret_cast<const char*>(chunk.hash), F_GENERIC_HASH_LEN);
+      std::unordered_map<std::string, uint64_t>::iterator known = sent.find(key);
+      if (known != sent.end() || store->has(chunk.hash)) {
+        msg::ChunkReference reference = {
+          chunk.offset,
+          chunk.length,
+          known != sent.end() ? known->second : F_CHUNK_NO_SOURCE,
+          chunk.hash
+        };
+        char buffer[msg::ChunkReference::fixed_size];
+        reference.encode(buffer);
+        references.append(buffer, sizeof(buffer));
+        if (++reference_count == references_per_package) {
+          queuePackage(0, reference_count, DeltaInstruction::references, references);
+          reference_count = 0;
+        }
+      } else {
+        sent.insert(std::make_pair(key, chunk.offset));
+        queueLiteral(chunk.offset, reinterpret_cast<const char*>(chunk_data), chunk.length);
+      }
+    }
+    offset = data[i].second;
+  }
+  if (reference_count > 0)
+    queuePackage(0, reference_count, DeltaInstruction::references, references);
+  flushPackages();
+  signature.finish();
+
+  for (std::vector<Chunk>::iterator i = chunks.begin(); i != chunks.end(); ++i)
+    store->add(*i, path.string());
+  prefetcher.stop();
+  ::close(fd);
+}
+
+/**
+ * Queues a package of the current transfer. Every package is held back 
+ * until the next one is known, so the last one can be sent without the 
+ * more flag. data is consumed. 
+ */
+void Dispatcher::queuePackage(const uint64_t offset,
+                              const uint64_t length,
+                              const uint8_t op,
+                              std::string& data) {
+  packLiterals(true);
+  if (has_pending_) {
+    sendDataPackage(pending_offset_, pending_length_, true, pending_op_,
+                    pending_data_.data(), pending_data_.size());
+  }
+  has_pending_ = true;
+  pending_offset_ = offset;
+  pending_length_ = length;
+  pending_op_ = op;
+  pending_data_.swap(data);
+  data.clear();
+}
+
+/**
+ * Queues literal file data. Adjacent literals are collected, so a 
+ * compressed package can carry as much of them as fits. 
+ */
+void Dispatcher::queueLiteral(const uint64_t offset,
+                              const char* data,
+                              const uint64_t length) {
+  if (!literals_.empty() && literals_offset_ + literals_.size() != offset)
+    packLiterals(true);
+  if (literals_.empty()) literals_offset_ = offset;
+  literals_.append(data, length);
+  packLiterals(false);
+}
+
+/**
+ * Turns the collected literals into packages, compressed ones where it 
+ * pays off. Unless all are to be packed, a remainder that may still 
+ * grow into a better compressed package is kept. 
+ */
+void Dispatcher::packLiterals(const bool all) {
+  uint64_t packed_length = 0;
+  while ( literals_.size() - packed_length > 0
+       && (all || literals_.size() - packed_length >= F_COMPRESSION_MAXIMUM_INPUT) ) {
+    const char* data = literals_.data() + packed_length;
+    uint64_t remaining = literals_.size() - packed_length;
+    uint64_t length = 0;
+    uint8_t op = DeltaInstruction::compressed;
+    if (compression_)
+      length = Compression::pack(data, remaining, packed_);
+    if (length == 0) {
+      length = std::min<uint64_t>(remaining, F_MAXIMUM_FILE_PACKAGE_SIZE);
+      packed_.assign(data, length);
+      op = DeltaInstruction::literal;
+    }
+
+    uint64_t offset = literals_offset_ + packed_length;
+    packed_length += length;
+    if (has_pending_) {
+      sendDataPackage(pending_offset_, pending_length_, true, pending_op_,
+                      pending_data_.data(), pending_data_.size());
+    }
+    has_pending_ = true;
+    pending_offset_ = offset;
+    pending_length_ = length;
+    pending_op_ = op;
+    // the buffers swap, so neither has to grow again
+    pending_data_.swap(packed_);
+    packed_.clear();
+  }
+  literals_.erase(0, packed_length);
+  literals_offset_ += packed_length;
+}
+
+/**
+ * Sends the last package of a transfer, or an empty one if there was 
+ * nothing to send at all. 
+ */
+void Dispatcher::flushPackages() {
+  packLiterals(true);
+  if (has_pending_) {
+    sendDataPackage(pending_offset_, pending_length_, false, pending_op_,
+                    pending_data_.data(), pending_data_.size());
+  } else {
+    sendDataPackage(0, 0, false, DeltaInstruction::literal, nullptr, 0);
+  }
+  has_pending_ = false;
+  pending_data_.clear();
+}
+
+/**
+ * Sends one package of file data: offset, length, whether more 
+ * packages follow and what the package carries: literal or compressed 
+ * data, the source offset of a copy, chunk references or nothing for a 
+ * hole. All packages 
+ * are padded to the same size. 
+ */
+void Dispatcher::sendDataPackage(const uint64_t offset,
+                                 const uint64_t length,
+                                 const bool more,
+                                 const uint8_t op,
+                                 const char* data,
+                                 const uint64_t data_length) const {
+  Frame message(F_SIGTYPE_PUB, current_status_);
+  message.setBox(box_hash_)
+         .setLane(lane_)
+         .setMore(more)
+         .setOp(op)
+         .setOffset(offset)
+         .setLength(length);
+  if (data_length > 0)
+    message.putBytes(data, data_length);
+  message.pad(F_FILE_PACKAGE_LEN);
+  s_send(pub_disp_channels, message);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(250));
+}
+
+int Dispatcher::synchronizingStop(Reactor& reactor) {
+  FrameView frame;
+  while (true) {
+    int z_return = receive(reactor, frame, 250, false);
+    if ( z_return >= 0 ) {
+      if ( frame.valid() && frame.type() == F_SIGTYPE_LIFE
+        && frame.status() == F_SIGLIFE_INTERRUPT ) {
         return 0;
       }
-      if ( msg_type == F_SIGTYPE_FSM  && msg_signal == fsm::status_155 ) {
-        uint64_t timing_offset;
-        char* timing_offset_c = new char[8];
-        sstream->seekg(1, std::ios_base::cur);
-        sstream->read(timing_offset_c, 8);
-        std::memcpy(&timing_offset, timing_offset_c, 8);
-        timing_offset_ = be64toh(timing_offset);
+      if ( frame.valid() && frame.type() == F_SIGTYPE_FSM
+        && frame.status() == fsm::status_155 ) {
+        timing_offset_ = frame.timestamp();
         waiting_for_stop_ = true;
       }
     } else {
@@ -262,32 +604,18 @@ int Dispatcher::synchronizingStop() {
       }
     }
 
-    delete sstream;
     sendFakeData();
   }
 
-  std::stringstream* message = new std::stringstream();
-  *message << F_SIGTYPE_FSM  << " "
-           << std::to_string(fsm::status_156);
-  zmqpp::message* z_msg = new zmqpp::message();
-  *z_msg << message->str();
-      z_boxoffice_pull->send(*z_msg);
+  s_send(*z_boxoffice_pull, Frame(F_SIGTYPE_FSM, fsm::status_156).setBox(box_hash_)
+                                                                  .setLane(lane_));
   return 1;
 }
 
 void Dispatcher::sendFakeData() const {
-  zmqpp::message* z_msg = new zmqpp::message();
-  std::stringstream* message = new std::stringstream();
-  *message << F_SIGTYPE_PUB  << " "
-           << current_status_;
-
-  int p = message->tellp();
-  *message << std::setw(F_MAXIMUM_FILE_PACKAGE_SIZE+22-p)
-           << std::setfill(' ') << " ";
-
-  *z_msg << message->str();
-  z_dispatcher->send(*z_msg);
-
-  delete message;
-  delete z_msg;
+  Frame message(F_SIGTYPE_PUB, current_status_);
+  message.setBox(box_hash_)
+         .setLane(lane_)
+         .pad(F_FILE_PACKAGE_LEN);
+  s_send(pub_disp_channels, message);
 }
@@ -7,10 +7,20 @@
  */
 
 #include "file.hpp"
+#include "sync_queue.hpp"
+#include "prefetcher.hpp"
 
 #include <endian.h>
+#include <sodium.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <climits>
+#include <cstring>
+#include <cerrno>
 #include <string>
 #include <sstream>
+#include <vector>
 #include <algorithm>
 #include <utility>
 #include <stdexcept>
@@ -27,7 +37,10 @@ File::File(const std::string& box_path,
             type_(),
             size_(),
             deleted_file_(false),
-            fstream_() {}
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {}
 File::File(const std::string& box_path,
            Hash* box_hash,
            const std::string& path,
@@ -42,11 +55,14 @@ File::File(const std::string& box_path,
             type_(type),
             size_(),
             deleted_file_(false),
-            fstream_() {
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {
   bpath_ = boost::filesystem::path(constructPath(box_path, path));
   checkArguments(path, type, create);
 
-  std::copy(path.begin(), path.end(), path_.begin());
+  path_ = path;
 
   if (boost::filesystem::exists(bpath_) || !create) {
     mtime_ = boost::filesystem::last_write_time(bpath_);
@@ -72,11 +88,14 @@ File::File(const std::string& box_path,
             type_(type),
             size_(),
             deleted_file_(false),
-            fstream_() {
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {
   bpath_ = boost::filesystem::path(constructPath(box_path, path));
   checkArguments(path, type, create);
 
-  std::copy(path.begin(), path.end(), path_.begin());
+  path_ = path;
 
   if (create)
     storeMetadata();
@@ -95,11 +114,14 @@ File::File(const std::string& box_path,
             type_(),
             size_(),
             deleted_file_(false),
-            fstream_() {
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {
   bpath_ = boost::filesystem::path(constructPath(box_path, path));
   checkArguments(path, file.getType(), create);
 
-  std::copy(path.begin(), path.end(), path_.begin());
+  path_ = path;
   type_ = file.getType();
   mode_ = file.getMode();
   mtime_ = file.getMtime();
@@ -121,7 +143,10 @@ File::File(const std::string& box_path,
             type_(),
             size_(),
             deleted_file_(false),
-            fstream_() {
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {
   bpath_ = boost::filesystem::path(constructPath(box_path, path));
 
   boost::system::error_code ec;
@@ -138,7 +163,7 @@ File::File(const std::string& box_path,
 
   checkArguments(path, type_, false);
 
-  std::copy(path.begin(), path.end(), path_.begin());
+  path_ = path;
 }
 File::File(const std::string& box_path,
            Hash* box_hash,
@@ -154,13 +179,15 @@ File::File(const std::string& box_path,
             type_(),
             size_(),
             deleted_file_(deleted_file),
-            fstream_() {
-  std::copy(path.begin(), path.end(), path_.begin());
+            staging_(false),
+            holes_(),
+            announced_(false),
+            fd_(-1) {
+  path_ = path;
   (void)create;  // suppressing warning about not using variable
 }
 File::~File() {
-  if (fstream_.is_open())
-    fstream_.close();
+  closeFile();
 }
 
 void File::checkArguments(const std::string& path,
@@ -179,7 +206,12 @@ void File::checkArguments(const std::string& path,
   // check if the file exists
   boost::system::error_code ec;
   if (!boost::filesystem::exists(bpath_, ec)) {
-    if (create) {
+    if (create && staging_ && type == boost::filesystem::regular_file) {
+      // staged files only appear once they have been completely received
+      if (!boost::filesystem::exists(bpath_.parent_path(), ec))
+        throw boost::filesystem::filesystem_error(
+          "Parent directory does not exist", bpath_, ec);
+    } else if (create) {
       boost::filesystem::path bpath_parent;
       if (path.back() == '/')
         bpath_parent = bpath_.parent_path().parent_path();
@@ -218,8 +250,7 @@ void File::checkArguments(const std::string& path,
 }
 
 const std::string File::getPath() const {
-  std::string path(path_.begin(), path_.end());
-  return path;
+  return path_.str();
 }
 boost::filesystem::perms File::getMode() const {
   return mode_;
@@ -246,6 +277,13 @@ void File::setMode(boost::filesystem::perms mode) {
 void File::setMtime(uint32_t mtime) {
   mtime_ = mtime;
 }
+void File::setStaging(bool staging) {
+  staging_ = staging;
+}
+void File::setHoles(const std::vector< std::pair<uint64_t, uint64_t> >& holes) {
+  holes_ = holes;
+  std::sort(holes_.begin(), holes_.end());
+}
 
 void File::storeMetadata() const {
   boost::filesystem::permissions(bpath_, mode_);
@@ -255,32 +293,123 @@ void File::storeMetadata() const {
 void File::resize(uint64_t const size) {
   if (type_ == boost::filesystem::regular_file) {
     size_ = size;
-    boost::system::error_code ec;
-    boost::filesystem::resize_file(bpath_, size_, ec);
-    if (ec != 0)
-      throw boost::filesystem::filesystem_error("", bpath_, ec);
+    truncate();
+    preallocate();
   }
 }
 void File::resize() {
   resize(size_);
 }
-void File::create() {
+/**
+ * \fn File::truncate
+ *
+ * Sets the size of the file without allocating its blocks, so a sparse 
+ * file stays sparse. 
+ */
+void File::truncate() {
   if (type_ == boost::filesystem::regular_file) {
-    openFile();
-  } else if (type_ == boost::filesystem::directory_file) {
-    boost::filesystem::create_directory(bpath_);
-  } else {
-    throw std::range_error("Tried to create file of unsupported filetype. ");
+    if (staging_) {
+      openFile();
+      if (::ftruncate(fd_, static_cast<off_t>(size_)) != 0)
+        throw boost::filesystem::filesystem_error("", getStagingPath(),
+          boost::system::error_code(errno, boost::system::system_category()));
+    } else {
+      boost::system::error_code ec;
+      boost::filesystem::resize_file(bpath_, size_, ec);
+      if (ec)
+        throw boost::filesystem::filesystem_error("", bpath_, ec);
+    }
+  }
+}
+/**
+ * \fn File::create
+ *
+ * Makes the file or directory if it does not exist yet. Regular files 
+ * that are staged only appear once they have been completely received. 
+ */
+void File::create() {
+  checkArguments(path_.str(), type_, true);
+}
+void File::remove() const {
+  if (boost::filesystem::exists(bpath_)) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(bpath_, ec);
+    if (ec)
+      throw boost::filesystem::filesystem_error("", bpath_, ec);
   }
 }
 
 void File::openFile() {
-  fstream_.open(bpath_.string(),
-    std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-  fstream_.unsetf(std::ios_base::skipws);
+  if (fd_ >= 0) return;
+
+  if (staging_) {
+    fd_ = ::open(getStagingPath().c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd_ < 0)
+      throw boost::filesystem::filesystem_error("", getStagingPath(),
+        boost::system::error_code(errno, boost::system::system_category()));
+    return;
+  }
+
+  fd_ = ::open(bpath_.c_str(), O_RDWR | O_CLOEXEC);
+  // files we only send may well be read-only
+  if (fd_ < 0 && errno == EACCES)
+    fd_ = ::open(bpath_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd_ < 0)
+    throw boost::filesystem::filesystem_error("", bpath_,
+      boost::system::error_code(errno, boost::system::system_category()));
+}
+int File::getFileDescriptor() {
+  openFile();
+  return fd_;
+}
+
+/**
+ * \fn File::prefetch
+ *
+ * Lets the kernel read the first length bytes of the file ahead, e.g. 
+ * while the file before it is still being sent. 
+ */
+void File::prefetch(const uint64_t length) {
+  if (deleted_file_ || type_ != boost::filesystem::regular_file || size_ == 0) return;
+  openFile();
+  Prefetcher::advise(fd_, 0, std::min(length, size_));
 }
+
 void File::closeFile() {
-  fstream_.close();
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+/**
+ * \fn File::preallocate
+ *
+ * Reserves the blocks for the complete file as soon as its size is known, 
+ * so the following writes neither fragment the file nor fail halfway 
+ * through for lack of space. Holes the sender announced are left 
+ * unallocated. Filesystems that do not support fallocate simply keep 
+ * the sparse file resize_file left behind. 
+ */
+void File::preallocate() {
+  if (size_ == 0) return;
+
+  openFile();
+  uint64_t offset = 0;
+  std::vector< std::pair<uint64_t, uint64_t> >::const_iterator hole = holes_.begin();
+  while (offset < size_) {
+    uint64_t end = size_;
+    if (hole != holes_.end()) end = std::min<uint64_t>(hole->first, size_);
+    if ( end > offset
+      && ::fallocate(fd_, 0, static_cast<off_t>(offset), static_cast<off_t>(end - offset)) != 0 ) {
+      if (errno == EOPNOTSUPP || errno == ENOSYS) return;
+      throw boost::filesystem::filesystem_error("", bpath_,
+        boost::system::error_code(errno, boost::system::system_category()));
+    }
+    if (hole == holes_.end()) break;
+    offset = std::max(offset, hole->first + hole->second);
+    ++hole;
+  }
 }
 
 uint64_t File::readFileData(char* data,
@@ -289,21 +418,22 @@ uint64_t File::readFileData(char* data,
                            bool* more) {
   if (deleted_file_) return 0;
 
-  if (!fstream_.is_open())
-    openFile();
-
-  uint64_t data_size;
-  if (size_ <= F_MAXIMUM_FILE_PACKAGE_SIZE && size_ <= size) {
-    fstream_.seekg(offset, std::ios_base::beg);
-    fstream_.read(data, size_);
-  } else if (size < F_MAXIMUM_FILE_PACKAGE_SIZE) {
-    fstream_.seekg(offset, std::ios_base::beg);
-    fstream_.read(data, size);
-  } else {
-    fstream_.seekg(offset, std::ios_base::beg);
-    fstream_.read(data, F_MAXIMUM_FILE_PACKAGE_SIZE);
+  openFile();
+
+  uint64_t length = std::min<uint64_t>(size, F_MAXIMUM_FILE_PACKAGE_SIZE);
+  if (offset >= size_)
+    length = 0;
+  else if (offset + length > size_)
+    length = size_ - offset;
+
+  uint64_t data_size = 0;
+  while (data_size < length) {
+    ssize_t r = ::pread(fd_, data + data_size, length - data_size,
+                        static_cast<off_t>(offset + data_size));
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) break;
+    data_size += r;
   }
-  data_size = fstream_.gcount();
 
   if (offset + data_size < size_) {
     *more = true;
@@ -314,34 +444,113 @@ uint64_t File::readFileData(char* data,
   return data_size;
 }
 uint64_t File::readFileData(char* data, uint64_t offset) {
-  return readFileData(data, F_MAXIMUM_FILE_PACKAGE_SIZE, offset, new bool());
+  bool more;
+  return readFileData(data, F_MAXIMUM_FILE_PACKAGE_SIZE, offset, &more);
 }
 uint64_t File::readFileData(char* data, uint64_t offset, bool* more) {
   return readFileData(data, F_MAXIMUM_FILE_PACKAGE_SIZE, offset, more);
 }
 
+/**
+ * \fn File::getDataRanges
+ *
+ * Returns the ranges of the file that hold data as begin and end 
+ * offsets, using SEEK_DATA and SEEK_HOLE. Holes smaller than 
+ * F_MINIMUM_HOLE_SIZE are not worth the bookkeeping and count as data. 
+ * Without support for either, the whole file is one range. 
+ */
+std::vector< std::pair<uint64_t, uint64_t> > File::getDataRanges() {
+  std::vector< std::pair<uint64_t, uint64_t> > ranges;
+  if (deleted_file_ || size_ == 0) return ranges;
+
+  openFile();
+  uint64_t pos = 0;
+  while (pos < size_) {
+    off_t data = ::lseek(fd_, static_cast<off_t>(pos), SEEK_DATA);
+    if (data < 0 && errno == ENXIO) break;
+    if (data < 0) {
+      ranges.assign(1, std::make_pair(0, size_));
+      return ranges;
+    }
+    off_t hole = ::lseek(fd_, data, SEEK_HOLE);
+    uint64_t end = (hole < 0) ? size_ : std::min<uint64_t>(hole, size_);
+    if (static_cast<uint64_t>(data) >= end) break;
+
+    if ( !ranges.empty()
+      && static_cast<uint64_t>(data) - ranges.back().second < F_MINIMUM_HOLE_SIZE )
+      ranges.back().second = end;
+    else
+      ranges.push_back(std::make_pair(static_cast<uint64_t>(data), end));
+    pos = end;
+  }
+
+  if (ranges.empty()) {
+    if (size_ < F_MINIMUM_HOLE_SIZE) ranges.push_back(std::make_pair(0, size_));
+    return ranges;
+  }
+  if (ranges.front().first < F_MINIMUM_HOLE_SIZE) ranges.front().first = 0;
+  if (size_ - ranges.back().second < F_MINIMUM_HOLE_SIZE) ranges.back().second = size_;
+  return ranges;
+}
+
+/**
+ * \fn File::getHoles
+ *
+ * Returns the holes of the file as offset and length, the gaps between 
+ * getDataRanges(). If there are more than max_count, only the largest 
+ * are returned. A max_count of 0 returns all of them. 
+ */
+std::vector< std::pair<uint64_t, uint64_t> > File::getHoles(const size_t max_count) {
+  std::vector< std::pair<uint64_t, uint64_t> > holes;
+  if (deleted_file_ || size_ == 0) return holes;
+  std::vector< std::pair<uint64_t, uint64_t> > ranges = getDataRanges();
+
+  uint64_t pos = 0;
+  for (std::vector< std::pair<uint64_t, uint64_t> >::iterator i = ranges.begin();
+       i != ranges.end(); ++i) {
+    if (i->first > pos) holes.push_back(std::make_pair(pos, i->first - pos));
+    pos = i->second;
+  }
+  if (pos < size_) holes.push_back(std::make_pair(pos, size_ - pos));
+
+  if (max_count > 0 && holes.size() > max_count) {
+    std::sort(holes.begin(), holes.end(),
+              [](const std::pair<uint64_t, uint64_t>& a,
+                 const std::pair<uint64_t, uint64_t>& b) { return a.second > b.second; });
+    holes.resize(max_count);
+    std::sort(holes.begin(), holes.end());
+  }
+  return holes;
+}
+
+/**
+ * \fn File::storeFileData
+ *
+ * Writes a package of file data at the given offset using a positioned 
+ * write, so neither a seek nor any metadata update is necessary per package. 
+ * Mode and mtime are applied only once by finishFileData(). 
+ */
 void File::storeFileData(const char* data,
                          const int64_t size,
                          const int64_t offset) {
   if (deleted_file_) return;
 
-  if (!fstream_.is_open()) {
-    openFile();
-  }
-
-  if ( static_cast<int64_t>(size_) <= F_MAXIMUM_FILE_PACKAGE_SIZE
-    && static_cast<int64_t>(size_) <= size) {
-    fstream_.seekp(offset);
-    fstream_.write(data, size_);
-  } else if (size < F_MAXIMUM_FILE_PACKAGE_SIZE) {
-    fstream_.seekp(offset);
-    fstream_.write(data, size);
-  } else {
-    fstream_.seekp(offset);
-    fstream_.write(data, F_MAXIMUM_FILE_PACKAGE_SIZE);
+  openFile();
+
+  int64_t length = std::min<int64_t>(size, F_MAXIMUM_FILE_PACKAGE_SIZE);
+  if (size_ > 0 && offset + length > static_cast<int64_t>(size_))
+    length = static_cast<int64_t>(size_) - offset;
+
+  int64_t written = 0;
+  while (written < length) {
+    ssize_t w = ::pwrite(fd_, data + written, length - written,
+                         static_cast<off_t>(offset + written));
+    if (w < 0 && errno == EINTR) continue;
+    if (w < 0)
+      throw boost::filesystem::filesystem_error("", bpath_,
+        boost::system::error_code(errno, boost::system::system_category()));
+    written += w;
   }
-
-  boost::filesystem::last_write_time(bpath_, static_cast<time_t>(mtime_));
 }
 void File::storeFileData(const char* data,
                          const uint64_t size,
@@ -351,6 +560,337 @@ void File::storeFileData(const char* data,
                 static_cast<int64_t>(offset));
 }
 
+/**
+ * \fn File::copyFileData
+ *
+ * Applies a copy instruction of a delta transfer: size bytes of the 
+ * current version of the file at source are copied to offset. A staged 
+ * file copies from its target, otherwise the data is moved within the 
+ * file, front to back, so the source must not lie before the offset. 
+ * Returns false if the data could not be copied completely. 
+ */
+bool File::copyFileData(const uint64_t source,
+                        const uint64_t size,
+                        const uint64_t offset) {
+  if (deleted_file_) return true;
+
+  openFile();
+
+  int source_fd = fd_;
+  if (staging_) {
+    source_fd = ::open(bpath_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (source_fd < 0) return false;
+  } else if (source == offset) {
+    // the data already is where it belongs
+    return true;
+  } else if (source < offset) {
+    return false;
+  }
+
+  uint64_t copied = 0;
+  if (staging_) {
+    // lets the filesystem share the blocks where it can
+    while (copied < size) {
+      loff_t in = static_cast<loff_t>(source + copied);
+      loff_t out = static_cast<loff_t>(offset + copied);
+      ssize_t c = ::copy_file_range(source_fd, &in, fd_, &out, size - copied, 0);
+      if (c < 0 && errno == EINTR) continue;
+      if (c <= 0) break;
+      copied += c;
+    }
+  }
+
+  std::vector<char> buffer(std::min<uint64_t>(size - copied, F_CONTENT_HASH_BLOCK_SIZE));
+  while (copied < size) {
+    ssize_t r = ::pread(source_fd, buffer.data(),
+                        std::min<uint64_t>(size - copied, buffer.size()),
+                        static_cast<off_t>(source + copied));
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) break;
+    ssize_t written = 0;
+    while (written < r) {
+      ssize_t w = ::pwrite(fd_, buffer.data() + written, r - written,
+                           static_cast<off_t>(offset + copied + written));
+      if (w < 0 && errno == EINTR) continue;
+      if (w < 0) break;
+      written += w;
+    }
+    if (written < r) break;
+    copied += r;
+  }
+
+  if (source_fd != fd_) ::close(source_fd);
+  return copied == size;
+}
+
+/**
+ * \fn File::storeChunk
+ *
+ * Stores a chunk the sender only referenced. If source is given, the 
+ * chunk was already received at that offset during this transfer, 
+ * otherwise it is looked up in the ChunkStore. Either way its content 
+ * is verified against its hash first. Returns false if the chunk could 
+ * not be found. 
+ */
+bool File::storeChunk(const Chunk& chunk, const uint64_t source) {
+  if (deleted_file_) return true;
+  if (chunk.length > F_CDC_MAXIMUM_CHUNK_SIZE) return false;
+
+  openFile();
+
+  std::vector<char> data;
+  if (source != F_CHUNK_NO_SOURCE) {
+    data.resize(chunk.length);
+    uint64_t read = 0;
+    while (read < chunk.length) {
+      ssize_t r = ::pread(fd_, data.data() + read, chunk.length - read,
+                          static_cast<off_t>(source + read));
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) return false;
+      read += r;
+    }
+    unsigned char hash[F_GENERIC_HASH_LEN];
+    crypto_generichash(hash, F_GENERIC_HASH_LEN,
+                       reinterpret_cast<unsigned char*>(data.data()), chunk.length, NULL, 0);
+    if (std::memcmp(hash, chunk.hash, F_GENERIC_HASH_LEN) != 0) return false;
+  } else if (!ChunkStore::getInstance()->get(chunk.hash, chunk.length, data)) {
+    return false;
+  }
+
+  uint64_t written = 0;
+  while (written < chunk.length) {
+    ssize_t w = ::pwrite(fd_, data.data() + written, chunk.length - written,
+                         static_cast<off_t>(chunk.offset + written));
+    if (w < 0 && errno == EINTR) continue;
+    if (w < 0) return false;
+    written += w;
+  }
+  return true;
+}
+
+/**
+ * \fn File::punchHole
+ *
+ * Deallocates a hole of the sent file, so it reads back as zeros 
+ * without occupying any blocks. Filesystems that cannot punch holes 
+ * get the zeros written instead. Returns false if neither worked. 
+ */
+bool File::punchHole(const uint64_t offset, const uint64_t length) {
+  if (deleted_file_ || length == 0) return true;
+
+  openFile();
+  if (::fallocate(fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                  static_cast<off_t>(offset), static_cast<off_t>(length)) == 0)
+    return true;
+  if (errno != EOPNOTSUPP && errno != ENOSYS) return false;
+
+  std::vector<char> zeros(std::min<uint64_t>(length, F_CONTENT_HASH_BLOCK_SIZE), 0);
+  uint64_t written = 0;
+  while (written < length) {
+    ssize_t w = ::pwrite(fd_, zeros.data(),
+                         std::min<uint64_t>(length - written, zeros.size()),
+                         static_cast<off_t>(offset + written));
+    if (w < 0 && errno == EINTR) continue;
+    if (w < 0) return false;
+    written += w;
+  }
+  return true;
+}
+
+/**
+ * \fn File::finishFileData
+ *
+ * Ends a transfer: applies mode and mtime to the open descriptor once 
+ * and closes the file. A staged file is first verified to have the 
+ * announced size and then handed to the SyncQueue, which moves it over 
+ * its target after syncing it. If a content hash is supplied, the data 
+ * has to match it as well. Returns false if the file failed 
+ * verification; it is then left in place. 
+ */
+bool File::finishFileData(const unsigned char* content_hash) {
+  if (deleted_file_) return true;
+
+  openFile();
+
+  struct stat st;
+  if (staging_) {
+    if (::fstat(fd_, &st) != 0 || static_cast<uint64_t>(st.st_size) != size_) {
+      closeFile();
+      return false;
+    }
+  } else if (::fstat(fd_, &st) == 0 && static_cast<uint64_t>(st.st_size) > size_) {
+    // a delta applied in place only shrinks the file at the very end
+    if (::ftruncate(fd_, static_cast<off_t>(size_)) != 0) {
+      closeFile();
+      return false;
+    }
+  }
+  if (content_hash != nullptr) {
+    unsigned char hash[F_GENERIC_HASH_LEN];
+    getContentHash(hash);
+    if (std::memcmp(hash, content_hash, F_GENERIC_HASH_LEN) != 0) {
+      closeFile();
+      return false;
+    }
+  }
+
+  struct timespec times[2];
+  times[0].tv_sec  = static_cast<time_t>(mtime_);
+  times[0].tv_nsec = 0;
+  times[1] = times[0];
+  if (::fchmod(fd_, static_cast<mode_t>(mode_ & boost::filesystem::perms_mask)) != 0
+   || ::futimens(fd_, times) != 0) {
+    boost::system::error_code ec(errno, boost::system::system_category());
+    closeFile();
+    throw boost::filesystem::filesystem_error("", bpath_, ec);
+  }
+
+  if (staging_) {
+    // the SyncQueue now owns the descriptor
+    SyncQueue::getInstance()->add(fd_, getStagingPath(), bpath_);
+    fd_ = -1;
+  } else {
+    closeFile();
+  }
+
+  return true;
+}
+
+/**
+ * \fn File::getContentHash
+ *
+ * Hashes the content of the file (or of its staged copy) with the same 
+ * generic hash (Blake2) used throughout flocksy, see hashContent(). 
+ */
+void File::getContentHash(unsigned char hash[F_GENERIC_HASH_LEN]) {
+  hashContent(nullptr, hash);
+}
+
+/**
+ * \fn File::getSignature
+ *
+ * Builds the block signatures of the file (or of its staged copy) 
+ * under its current size and mtime. If content_hash is given, the 
+ * content hash is computed in the same pass. 
+ */
+void File::getSignature(Signature& signature, unsigned char* content_hash) {
+  signature.begin(size_, mtime_);
+  hashContent(&signature, content_hash);
+  signature.finish();
+}
+
+/**
+ * \fn File::hashContent
+ *
+ * Reads the file up to its size once for the signature and the content 
+ * hash. Only the data between the holes set for the file is read and 
+ * hashed; the signature gets zeros for the holes instead. The list of 
+ * holes is hashed after the data, so sender and receiver agree on the 
+ * hash as long as they agree on the holes. A file without holes hashes 
+ * to the hash of its plain content. 
+ */
+void File::hashContent(Signature* signature, unsigned char* content_hash) {
+  crypto_generichash_state state;
+  crypto_generichash_init(&state, NULL, 0, F_GENERIC_HASH_LEN);
+
+  if (!deleted_file_ && type_ == boost::filesystem::regular_file) {
+    openFile();
+    std::vector<unsigned char> buffer(F_CONTENT_HASH_BLOCK_SIZE);
+    std::vector< std::pair<uint64_t, uint64_t> >::const_iterator hole = holes_.begin();
+    uint64_t offset = 0;
+    while (offset < size_) {
+      uint64_t end = size_;
+      if (hole != holes_.end()) end = std::min<uint64_t>(std::max(hole->first, offset), size_);
+      while (offset < end) {
+        ssize_t r = ::pread(fd_, buffer.data(), std::min<uint64_t>(buffer.size(), end - offset),
+                            static_cast<off_t>(offset));
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        if (content_hash != nullptr) crypto_generichash_update(&state, buffer.data(), r);
+        if (signature != nullptr) signature->update(buffer.data(), r);
+        offset += r;
+      }
+      if (offset < end || hole == holes_.end()) break;
+
+      end = (hole->first >= size_) ? size_
+          : hole->first + std::min(hole->second, size_ - hole->first);
+      if (signature != nullptr && end > offset) {
+        std::fill(buffer.begin(), buffer.end(), 0);
+        for (uint64_t zeros = end - offset; zeros > 0; ) {
+          uint64_t length = std::min<uint64_t>(buffer.size(), zeros);
+          signature->update(buffer.data(), length);
+          zeros -= length;
+        }
+      }
+      offset = std::max(offset, end);
+      ++hole;
+    }
+
+    for (std::vector< std::pair<uint64_t, uint64_t> >::const_iterator i = holes_.begin();
+         i != holes_.end(); ++i) {
+      uint64_t range[2] = { htole64(i->first), htole64(i->second) };
+      crypto_generichash_update(&state, reinterpret_cast<const unsigned char*>(range), sizeof(range));
+    }
+  }
+
+  if (content_hash != nullptr) crypto_generichash_final(&state, content_hash, F_GENERIC_HASH_LEN);
+}
+
+/**
+ * \fn File::prepareAnnouncement
+ *
+ * Looks up the largest holes of the file, at most max_count of them, 
+ * and its content hash over them, which is what the file is announced 
+ * with. Reads the complete file, so this is left to the ContentHasher. 
+ */
+void File::prepareAnnouncement(const size_t max_count) {
+  holes_.clear();
+  if (max_count > 0) holes_ = getHoles(max_count);
+  getContentHash(content_hash_);
+  announced_ = true;
+}
+
+void File::setAnnouncement(const unsigned char content_hash[F_GENERIC_HASH_LEN],
+                           const std::vector< std::pair<uint64_t, uint64_t> >& holes) {
+  std::memcpy(content_hash_, content_hash, F_GENERIC_HASH_LEN);
+  setHoles(holes);
+  announced_ = true;
+}
+
+const unsigned char* File::getAnnouncedContentHash() const {
+  return announced_ ? content_hash_ : nullptr;
+}
+const std::vector< std::pair<uint64_t, uint64_t> >& File::getAnnouncedHoles() const {
+  return holes_;
+}
+
+/**
+ * \fn File::indexChunks
+ *
+ * Adds all chunks of the file to the ChunkStore under its target path, 
+ * so later transfers of the same content only need to reference them. 
+ */
+void File::indexChunks() {
+  if (deleted_file_ || type_ != boost::filesystem::regular_file) return;
+
+  openFile();
+  ChunkStore::getInstance()->addFile(fd_, size_, bpath_.string());
+}
+
+/**
+ * \fn File::getStagingPath
+ *
+ * The staged copy lives next to its target, so the final rename never 
+ * crosses a filesystem. Its name is derived from the target's, so an 
+ * interrupted transfer finds its staged data again. 
+ */
+const boost::filesystem::path File::getStagingPath() const {
+  std::string name = bpath_.filename().string();
+  if (name.length() + std::strlen(F_STAGING_PREFIX) > NAME_MAX)
+    name = Hash(name).getString().substr(0, 64);
+  return bpath_.parent_path() / (F_STAGING_PREFIX + name);
+}
+
 const std::string File::constructPath(const std::string box_path,
                                       const std::string path) const {
   std::string complete_path;
@@ -366,98 +906,89 @@ const std::string File::constructPath(const std::string box_path,
   return complete_path;
 }
 
-std::ostream& operator<<(std::ostream& ostream, const File& f) {
-  ostream.write(reinterpret_cast<char*>(
-                  const_cast<unsigned char*>(f.box_hash_->getBytes())
-                ), F_GENERIC_HASH_LEN);
-
-  std::string path(f.path_.begin(), f.path_.end());
-  ostream.write(path.c_str(), F_MAXIMUM_PATH_LENGTH);
+/**
+ * \fn File::serialize
+ *
+ * Writes the metadata record of the file: the path as encoded by 
+ * codec and either mode, type, mtime and size or the deletion marker. 
+ * The box travels in the header of the frame carrying the record. 
+ */
+void File::serialize(std::ostream& ostream, PathCodec& codec) const {
+  codec.encode(ostream, path_.str());
 
-  if (f.deleted_file_) {
-    ostream << "IN_DELETE\0";
-    return ostream;
+  if (deleted_file_) {
+    ostream << "IN_DELETE";
+    return;
   }
 
-  uint16_t mode = htobe16(f.mode_);
+  uint16_t mode = htobe16(mode_);
   ostream.write((const char*)&mode, 2);
 
-  uint8_t type = uint8_t(f.type_);
+  uint8_t type = uint8_t(type_);
   ostream.write((const char*)&type, 1);
 
-  uint32_t mtime = htobe32(f.mtime_);
+  uint32_t mtime = htobe32(mtime_);
   ostream.write((const char*)&mtime, 4);
 
-  if (f.type_ == boost::filesystem::regular_file) {
-    uint64_t size = htobe64(f.size_);
-    char* size_char = new char[8];
-    std::memcpy(size_char, &size, 8);
-    ostream.write(size_char, 8);
-  } else {
-    uint64_t size = htobe64(0);
-    char* size_char = new char[8];
-    std::memcpy(size_char, &size, 8);
-    ostream.write(size_char, 8);
-  }
+  uint64_t size = htobe64(type_ == boost::filesystem::regular_file ? size_ : 0);
+  ostream.write((const char*)&size, 8);
+}
 
+std::ostream& operator<<(std::ostream& ostream, const File& f) {
+  PathCodec codec;
+  f.serialize(ostream, codec);
   return ostream;
 }
 
-std::istream& operator>>(std::istream& istream, File& f) {
-  if (f.box_hash_ == nullptr || f.box_path_.length() == 0)
+/**
+ * \fn File::deserialize
+ *
+ * Reads a metadata record written by serialize() into a File of the 
+ * box the record belongs to. Nothing is changed on disk; missing 
+ * entries are made by create() and deletions by remove(). 
+ */
+void File::deserialize(std::istream& istream, PathCodec& codec) {
+  if (box_hash_ == nullptr || box_path_.length() == 0)
     throw std::out_of_range("Box info not found, File object probably not correctly initialised.");
 
-  char* path_c = new char[F_MAXIMUM_PATH_LENGTH];
-  istream.read(path_c, F_MAXIMUM_PATH_LENGTH);
-  for (int i = 0; i < F_MAXIMUM_PATH_LENGTH; ++i) {
-    f.path_[i] = path_c[i];
-  }
-  std::string path(f.path_.begin(), f.path_.end());
-
-  std::string deleted;
-  istream >> deleted;
-  if (deleted == "IN_DELETE") {
-    f.deleted_file_ = true;
-    f.bpath_ = boost::filesystem::path(f.constructPath(f.box_path_, path));
-    if (boost::filesystem::exists(f.bpath_)) {
-      boost::system::error_code ec;
-      boost::filesystem::remove(f.bpath_, ec);
-      if (ec != 0)
-        throw boost::filesystem::filesystem_error("", f.bpath_, ec);
-    }
-    return istream;
-  } else {
-    istream.seekg(-1*deleted.length(), std::ios_base::cur);
+  std::string path;
+  if (!codec.decode(istream, path))
+    throw std::range_error("Malformed or too long path in file metadata. ");
+  path_ = path;
+
+  std::streampos marker_pos = istream.tellg();
+  char marker[9];
+  istream.read(marker, 9);
+  if (istream.gcount() == 9 && std::memcmp(marker, "IN_DELETE", 9) == 0) {
+    deleted_file_ = true;
+    bpath_ = boost::filesystem::path(constructPath(box_path_, path));
+    return;
   }
+  istream.clear();
+  istream.seekg(marker_pos);
 
-  f.bpath_ = boost::filesystem::path(f.constructPath(f.box_path_, path));
+  bpath_ = boost::filesystem::path(constructPath(box_path_, path));
 
-  char* mode_c = new char[2];
-  istream.read(mode_c, 2);
   uint16_t mode;
-  std::memcpy(&mode, mode_c, 2);
-  f.mode_ = boost::filesystem::perms(be16toh(mode));
+  istream.read((char*)&mode, 2);
+  mode_ = boost::filesystem::perms(be16toh(mode));
 
-  char* type_c = new char[1];
-  istream.read(type_c, 1);
   uint8_t type;
-  std::memcpy(&type, type_c, 1);
-  f.type_ = boost::filesystem::file_type(type);
+  istream.read((char*)&type, 1);
+  type_ = boost::filesystem::file_type(type);
 
-  char* mtime_c = new char[4];
-  istream.read(mtime_c, 4);
   uint32_t mtime;
-  std::memcpy(&mtime, mtime_c, 4);
-  f.mtime_ = be32toh(mtime);
+  istream.read((char*)&mtime, 4);
+  mtime_ = be32toh(mtime);
 
-  f.checkArguments(path, f.type_, true);
+  // written for every type, so the next record of a batch starts right
+  uint64_t size;
+  istream.read((char*)&size, 8);
+  size_ = type_ == boost::filesystem::regular_file ? be64toh(size) : 0;
+}
 
-  if (f.type_ == boost::filesystem::regular_file) {
-    char* size_c = new char[8];
-    istream.read(size_c, 8);
-    uint64_t size;
-    std::memcpy(&size, size_c, 8);
-    f.size_ = be64toh(size);
-  }
+std::istream& operator>>(std::istream& istream, File& f) {
+  PathCodec codec;
+  f.deserialize(istream, codec);
   return istream;
 }
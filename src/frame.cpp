@@ -0,0 +1,274 @@
+/**
+ * \file      frame.cpp
+ * \brief     Binary frames of all messages between and within nodes. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "frame.hpp"
+
+#include <endian.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+  template <typename T>
+  T load(const unsigned char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+}
+
+/**
+ * \fn FrameView::FrameView
+ *
+ * Checks the header; the view stays invalid if the data is no frame 
+ * of this version or shorter than its payload. 
+ */
+FrameView::FrameView(const void* data, const size_t size) :
+  data_(nullptr),
+  size_(0) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  if ( bytes == nullptr || size < F_FRAME_HEADER_LEN
+    || bytes[F_FRAME_MAGIC_POS] != F_FRAME_MAGIC
+    || bytes[F_FRAME_VERSION_POS] != F_FRAME_VERSION ) return;
+  uint32_t payload_length = le32toh(load<uint32_t>(bytes + F_FRAME_PAYLOAD_LENGTH_POS));
+  if (payload_length > size - F_FRAME_HEADER_LEN) return;
+  data_ = bytes;
+  size_ = size;
+}
+
+uint8_t FrameView::type() const {
+  return data_[F_FRAME_TYPE_POS];
+}
+int32_t FrameView::status() const {
+  return static_cast<int32_t>(le32toh(load<uint32_t>(data_ + F_FRAME_STATUS_POS)));
+}
+bool FrameView::more() const {
+  return (data_[F_FRAME_FLAGS_POS] & F_FRAME_MORE) != 0;
+}
+uint8_t FrameView::op() const {
+  return data_[F_FRAME_OP_POS];
+}
+uint8_t FrameView::lane() const {
+  return data_[F_FRAME_LANE_POS];
+}
+uint64_t FrameView::timestamp() const {
+  return le64toh(load<uint64_t>(data_ + F_FRAME_TIMESTAMP_POS));
+}
+uint64_t FrameView::offset() const {
+  return le64toh(load<uint64_t>(data_ + F_FRAME_OFFSET_POS));
+}
+uint64_t FrameView::length() const {
+  return le64toh(load<uint64_t>(data_ + F_FRAME_LENGTH_POS));
+}
+const unsigned char* FrameView::box() const {
+  return data_ + F_FRAME_BOX_POS;
+}
+const unsigned char* FrameView::node() const {
+  return data_ + F_FRAME_NODE_POS;
+}
+const char* FrameView::payload() const {
+  return reinterpret_cast<const char*>(data_ + F_FRAME_HEADER_LEN);
+}
+size_t FrameView::payloadSize() const {
+  return le32toh(load<uint32_t>(data_ + F_FRAME_PAYLOAD_LENGTH_POS));
+}
+
+Frame::Frame(const uint8_t type, const int32_t status) :
+  pool_(BufferPool::getInstance()),
+  buffer_(pool_->acquire()),
+  size_(F_FRAME_HEADER_LEN),
+  payload_end_(F_FRAME_HEADER_LEN) {
+  std::memset(buffer_, 0, F_FRAME_HEADER_LEN);
+  buffer_[F_FRAME_MAGIC_POS] = static_cast<char>(F_FRAME_MAGIC);
+  buffer_[F_FRAME_VERSION_POS] = static_cast<char>(F_FRAME_VERSION);
+  buffer_[F_FRAME_TYPE_POS] = static_cast<char>(type);
+  uint32_t status_le = htole32(static_cast<uint32_t>(status));
+  std::memcpy(&buffer_[F_FRAME_STATUS_POS], &status_le, 4);
+}
+
+Frame::Frame(const FrameView& frame) :
+  pool_(BufferPool::getInstance()),
+  buffer_(nullptr),
+  size_(F_FRAME_HEADER_LEN + frame.payloadSize()),
+  payload_end_(size_) {
+  if ( size_ > F_FRAME_BUFFER_SIZE )
+    throw std::length_error("frame exceeds its buffer");
+  buffer_ = pool_->acquire();
+  std::memcpy(buffer_, frame.payload() - F_FRAME_HEADER_LEN, size_);
+}
+
+Frame::Frame(Frame&& other) :
+  pool_(other.pool_),
+  buffer_(other.release()),
+  size_(other.size_),
+  payload_end_(other.payload_end_) {}
+
+Frame& Frame::operator=(Frame&& other) {
+  if ( this != &other ) {
+    if ( buffer_ != nullptr ) pool_->put(buffer_);
+    pool_ = other.pool_;
+    buffer_ = other.release();
+    size_ = other.size_;
+    payload_end_ = other.payload_end_;
+  }
+  return *this;
+}
+
+Frame::~Frame() {
+  if ( buffer_ != nullptr ) pool_->put(buffer_);
+}
+
+char* Frame::release() {
+  char* buffer = buffer_;
+  buffer_ = nullptr;
+  return buffer;
+}
+
+Frame& Frame::setMore(const bool more) {
+  if (more) buffer_[F_FRAME_FLAGS_POS] |= F_FRAME_MORE;
+  else      buffer_[F_FRAME_FLAGS_POS] &= ~F_FRAME_MORE;
+  return *this;
+}
+Frame& Frame::setOp(const uint8_t op) {
+  buffer_[F_FRAME_OP_POS] = static_cast<char>(op);
+  return *this;
+}
+Frame& Frame::setLane(const uint8_t lane) {
+  buffer_[F_FRAME_LANE_POS] = static_cast<char>(lane);
+  return *this;
+}
+Frame& Frame::setTimestamp(const uint64_t timestamp) {
+  uint64_t value = htole64(timestamp);
+  std::memcpy(&buffer_[F_FRAME_TIMESTAMP_POS], &value, 8);
+  return *this;
+}
+Frame& Frame::setOffset(const uint64_t offset) {
+  uint64_t value = htole64(offset);
+  std::memcpy(&buffer_[F_FRAME_OFFSET_POS], &value, 8);
+  return *this;
+}
+Frame& Frame::setLength(const uint64_t length) {
+  uint64_t value = htole64(length);
+  std::memcpy(&buffer_[F_FRAME_LENGTH_POS], &value, 8);
+  return *this;
+}
+Frame& Frame::setBox(const unsigned char box[F_GENERIC_HASH_LEN]) {
+  std::memcpy(&buffer_[F_FRAME_BOX_POS], box, F_GENERIC_HASH_LEN);
+  return *this;
+}
+Frame& Frame::setNode(const unsigned char node[F_GENERIC_HASH_LEN]) {
+  std::memcpy(&buffer_[F_FRAME_NODE_POS], node, F_GENERIC_HASH_LEN);
+  return *this;
+}
+
+Frame& Frame::putU8(const uint8_t value) {
+  return putBytes(&value, 1);
+}
+Frame& Frame::putU32(const uint32_t value) {
+  uint32_t value_le = htole32(value);
+  return putBytes(&value_le, 4);
+}
+Frame& Frame::putU64(const uint64_t value) {
+  uint64_t value_le = htole64(value);
+  return putBytes(&value_le, 8);
+}
+Frame& Frame::putBytes(const void* data, const size_t length) {
+  if ( length > F_FRAME_BUFFER_SIZE - payload_end_ )
+    throw std::length_error("frame exceeds its buffer");
+  // padding is dropped once the payload grows again
+  std::memcpy(buffer_ + payload_end_, data, length);
+  payload_end_ += length;
+  size_ = payload_end_;
+  uint32_t payload_length = htole32(static_cast<uint32_t>(payload_end_ - F_FRAME_HEADER_LEN));
+  std::memcpy(&buffer_[F_FRAME_PAYLOAD_LENGTH_POS], &payload_length, 4);
+  return *this;
+}
+Frame& Frame::putString(const std::string& s) {
+  putU32(static_cast<uint32_t>(s.size()));
+  return putBytes(s.data(), s.size());
+}
+
+/**
+ * \fn Frame::pad
+ *
+ * Pads the frame to size bytes, so frames of different content look 
+ * the same on the wire. 
+ */
+void Frame::pad(const size_t size) {
+  if ( size > F_FRAME_BUFFER_SIZE )
+    throw std::length_error("frame exceeds its buffer");
+  if ( size_ < size ) {
+    std::memset(buffer_ + size_, 0, size - size_);
+    size_ = size;
+  }
+}
+
+PayloadReader::PayloadReader(const FrameView& frame) :
+  data_(frame.valid() ? frame.payload() : nullptr),
+  size_(frame.valid() ? frame.payloadSize() : 0),
+  pos_(0),
+  ok_(frame.valid()) {}
+PayloadReader::PayloadReader(const char* data, const size_t size) :
+  data_(data),
+  size_(size),
+  pos_(0),
+  ok_(true) {}
+
+uint8_t PayloadReader::getU8() {
+  const char* data = getBytes(1);
+  return data == nullptr ? 0 : static_cast<uint8_t>(data[0]);
+}
+uint32_t PayloadReader::getU32() {
+  const char* data = getBytes(4);
+  return data == nullptr ? 0 : le32toh(load<uint32_t>(reinterpret_cast<const unsigned char*>(data)));
+}
+uint64_t PayloadReader::getU64() {
+  const char* data = getBytes(8);
+  return data == nullptr ? 0 : le64toh(load<uint64_t>(reinterpret_cast<const unsigned char*>(data)));
+}
+const char* PayloadReader::getBytes(const size_t length) {
+  if (!ok_ || length > size_ - pos_) {
+    ok_ = false;
+    return nullptr;
+  }
+  const char* data = data_ + pos_;
+  pos_ += length;
+  return data;
+}
+const char* PayloadReader::getString(size_t& length) {
+  length = getU32();
+  const char* data = getBytes(length);
+  if (data == nullptr) length = 0;
+  return data;
+}
+
+MemoryInputStream::MemoryInputStream(const char* data, const size_t size) :
+  std::istream(nullptr),
+  buffer_(data, size) {
+  rdbuf(&buffer_);
+}
+
+MemoryInputStream::buffer_t::buffer_t(const char* data, const size_t size) {
+  char* begin = const_cast<char*>(data);
+  setg(begin, begin, begin + size);
+}
+
+std::streambuf::pos_type MemoryInputStream::buffer_t::seekoff(off_type off,
+                                                              std::ios_base::seekdir dir,
+                                                              std::ios_base::openmode which) {
+  if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+  char* target;
+  if (dir == std::ios_base::beg)      target = eback() + off;
+  else if (dir == std::ios_base::cur) target = gptr() + off;
+  else                                target = egptr() + off;
+  if (target < eback() || target > egptr()) return pos_type(off_type(-1));
+  setg(eback(), target, egptr());
+  return pos_type(target - eback());
+}
+std::streambuf::pos_type MemoryInputStream::buffer_t::seekpos(pos_type pos,
+                                                              std::ios_base::openmode which) {
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
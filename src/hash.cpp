@@ -16,15 +16,13 @@
 #include <iostream>
 
 Hash::Hash() :
-        hash_(new unsigned char[F_GENERIC_HASH_LEN]),
+        hash_(),
         empty_(true) {}
 Hash::Hash(const unsigned char hash_bytes[F_GENERIC_HASH_LEN]) :
-        hash_(new unsigned char[F_GENERIC_HASH_LEN]),
         empty_(false) {
     std::memcpy(hash_, hash_bytes, F_GENERIC_HASH_LEN);
 }
 Hash::Hash(const std::string& string) :
-        hash_(new unsigned char[F_GENERIC_HASH_LEN]),
         empty_(true) {
     makeHash(string);
 }
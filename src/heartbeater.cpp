@@ -4,6 +4,9 @@
 
 #include "constants.hpp"
 #include "heartbeater.hpp"
+#include "reactor.hpp"
+#include "config.hpp"
+#include "message_schema.hpp"
 
 #include <unistd.h>
 #include <endian.h>
@@ -15,41 +18,58 @@
 #include <boost/thread.hpp>
 #include <chrono>
 #include <thread>
+#include <cstring>
+#include <algorithm>
 
 Heartbeater::Heartbeater(zmqpp::context* z_ctx_, fsm::status_t status) :
   Transmitter(z_ctx_),
-  z_heartbeater(nullptr), 
-  z_boxoffice_hb_push(nullptr),
-  current_status_(status),
-  current_message_("") {
+  pub_hb_channels(),
+  bo_hb_channel(nullptr),
+  interval_(Config::getInstance()->getHeartbeatInterval()),
+  idle_status_(status),
+  box_ids_(),
+  sessions_(),
+  changed_(),
+  last_session_(0),
+  delays_(),
+  last_peer_(0) {
     tac = (char*)"hb";
+    // the boxes are known up front, so the sessions are allocated once
+    std::map< std::string, box_t > boxes = Config::getInstance()->getBoxes();
+    for (std::map<std::string,box_t>::iterator i = boxes.begin(); i != boxes.end(); ++i)
+      box_ids_.intern(i->second.uid);
+    resizeSessions(box_ids_.size());
     this->connectToBoxofficeHB();
     this->connectToPublisher();
 }
 
-Heartbeater::~Heartbeater() {
-  z_boxoffice_hb_push->close();
-  z_heartbeater->close();
+Heartbeater::~Heartbeater() {}
 
-  delete z_boxoffice_hb_push;
-  delete z_heartbeater;
+void Heartbeater::resizeSessions(const size_t boxes)
+{
+  heartbeat_t idle;
+  idle.status = idle_status_;
+  idle.busy = false;
+  idle.changed = false;
+  idle.length = 0;
+  sessions_.resize(boxes * F_PIPELINE_LANES, idle);
+  changed_.reserve(sessions_.size());
 }
 
 int Heartbeater::connectToPublisher()
 {
-  // connect to process broadcast
-  z_heartbeater = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pair);
-  z_heartbeater->bind("inproc://pub_hb_pair");
+  // one for the publisher of every host
+  std::vector<host_t> hosts = Config::getInstance()->getHosts();
+  for (std::vector<host_t>::iterator i = hosts.begin(); i != hosts.end(); ++i)
+    pub_hb_channels.push_back(s_channel("pub_hb" + i->endpoint));
 
   return 0;
 }
 
 int Heartbeater::connectToBoxofficeHB()
 {
-  // open connection to receive HB data from boxoffice
-  z_boxoffice_hb_push = new zmqpp::socket(*z_ctx, zmqpp::socket_type::sub);
-  z_boxoffice_hb_push->connect("inproc://f_boxoffice_hb_push_out");
-  z_boxoffice_hb_push->subscribe("");
+  // receives HB data from boxoffice
+  bo_hb_channel = s_channel("bo_hb");
 
   return 0;
 }
@@ -62,50 +82,123 @@ int Heartbeater::run()
 
   if (F_MSG_DEBUG) printf("hb: starting hb socket and sending...\n");
 
-  std::stringstream* sstream;
-  int msg_type, msg_signal;
-
+  zmqpp::message z_msg;
+  FrameView frame;
+  Reactor reactor;
+  reactor.add(*z_broadcast);
+  reactor.add(*z_boxoffice_push);
+  reactor.add(*bo_hb_channel);
+
+  // the schedule is kept on the steady clock, so handling the inputs 
+  // does not delay the ticks
+  const std::chrono::milliseconds tick(std::max<uint32_t>(interval_ / F_HEARTBEAT_TICKS, 1));
+  std::chrono::steady_clock::time_point next_tick = std::chrono::steady_clock::now();
+  bool interrupted = false;
   while(true)
   {
-    // waiting for boxoffice input in non-blocking mode
-    sstream = new std::stringstream();
-    int z_return = s_recv_noblock(*z_boxoffice_push, *z_boxoffice_hb_push, *z_broadcast, *sstream, 1);
-
-    if ( z_return != 0 ) {
-      *sstream >> msg_type >> msg_signal;
-      if ( msg_type == F_SIGTYPE_LIFE && msg_signal == F_SIGLIFE_INTERRUPT ) break;
-      if ( msg_type == F_SIGTYPE_FSM ) {
-        current_status_ = (fsm::status_t)msg_signal;
-        std::getline(*sstream, current_message_);
+    // everything that comes in until the next tick is taken, the latest 
+    // status of a session wins
+    next_tick += tick;
+    long remaining;
+    while ( !interrupted
+         && (remaining = std::chrono::duration_cast< std::chrono::milliseconds >(
+               next_tick - std::chrono::steady_clock::now()).count()) > 0
+         && reactor.receive(z_msg, frame, remaining) >= 0 ) {
+      if ( !frame.valid() ) continue;
+      if ( frame.type() == F_SIGTYPE_LIFE && frame.status() == F_SIGLIFE_INTERRUPT ) {
+        interrupted = true;
+      } else if ( frame.type() == F_SIGTYPE_FSM
+               && ( frame.payloadSize() > F_HEARTBEAT_PAYLOAD_LEN
+                 || frame.lane() >= F_PIPELINE_LANES ) ) {
+        // would make the heartbeats of this session stand out
+        std::cerr << "[E] hb: refusing status " << frame.status() << " payload of "
+                  << frame.payloadSize() << " bytes" << std::endl;
+      } else if ( frame.type() == F_SIGTYPE_FSM ) {
+        // a session is a lane of a box
+        const uint32_t box = box_ids_.intern(frame.box());
+        if ( box >= sessions_.size() / F_PIPELINE_LANES ) resizeSessions(box + 1);
+        const size_t session = box * F_PIPELINE_LANES + frame.lane();
+        heartbeat_t& heartbeat = sessions_[session];
+        heartbeat.status = (fsm::status_t)frame.status();
+        heartbeat.busy = true;
+        heartbeat.length = frame.payloadSize();
+        std::memcpy(heartbeat.message, frame.payload(), heartbeat.length);
+        if ( !heartbeat.changed ) {
+          heartbeat.changed = true;
+          changed_.push_back(session);
+        }
+      } else if ( frame.type() == F_SIGTYPE_CLOCK ) {
+        delays_[s_node_id(frame.node())] = frame.length();
       }
     }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-    if (F_MSG_DEBUG) printf("hb: sending hb status code %d\n", (int)current_status_);
+    if ( interrupted ) break;
+
+    // one heartbeat per tick, whatever the number of sessions, so the 
+    // traffic looks the same; a session that changed goes first, the 
+    // busy sessions take turns otherwise
+    size_t next = sessions_.size();
+    if ( !changed_.empty() ) {
+      next = changed_.front();
+      changed_.erase(changed_.begin());
+      sessions_[next].changed = false;
+    } else {
+      for (size_t i = 1; i <= sessions_.size(); ++i) {
+        const size_t candidate = (last_session_ + i) % sessions_.size();
+        if ( sessions_[candidate].busy ) {
+          next = candidate;
+          last_session_ = candidate;
+          break;
+        }
+      }
+    }
+    static const unsigned char no_box[F_GENERIC_HASH_LEN] = {};
+    fsm::status_t status = idle_status_;
+    const unsigned char* box = no_box;
+    uint8_t lane = 0;
+    const char* message = nullptr;
+    size_t length = 0;
+    if ( next < sessions_.size() ) {
+      heartbeat_t& current = sessions_[next];
+      status = current.status;
+      box = box_ids_.get(next / F_PIPELINE_LANES);
+      lane = static_cast<uint8_t>(next % F_PIPELINE_LANES);
+      message = current.message;
+      length = current.length;
+      // a session that went idle is announced once, then it is dropped
+      if ( status == idle_status_ ) current.busy = false;
+    }
+    if (F_MSG_DEBUG) printf("hb: sending hb status code %d\n", (int)status);
+
+    // every heartbeat tells one node in turn how long its heartbeats 
+    // took to us, so it can work out the round trip and the clock offset
+    uint64_t peer = 0;
+    uint64_t delay = 0;
+    if ( !delays_.empty() ) {
+      std::map<uint64_t, uint64_t>::iterator report = delays_.upper_bound(last_peer_);
+      if ( report == delays_.end() ) report = delays_.begin();
+      last_peer_ = report->first;
+      peer = report->first;
+      delay = report->second;
+    }
 
     // send a message
-    uint64_t timestamp = htobe64(
+    uint64_t timestamp = 
       std::chrono::duration_cast< std::chrono::milliseconds >(
         std::chrono::system_clock::now().time_since_epoch()
-      ).count()
-    );
-    char* timestamp_c = new char(8);
-    std::memcpy(timestamp_c, &timestamp, 8);
-
-    std::stringstream* message = new std::stringstream();
-    *message << F_SIGTYPE_PUB  << " "
-             << current_status_ << " ";
-    message->write(timestamp_c, 8);
-    *message << current_message_;
-    zmqpp::message z_msg;
-    z_msg << message->str();
-    z_heartbeater->send(z_msg, true);
-
-    delete message;
-    delete sstream;
+      ).count();
+
+    Frame heartbeat(F_SIGTYPE_PUB, status);
+    heartbeat.setTimestamp(timestamp)
+             .setBox(box)
+             .setLane(lane)
+             .setOffset(peer)
+             .setLength(delay);
+    if ( length > 0 ) heartbeat.putBytes(message, length);
+    // every tick sends a heartbeat of the same length, whatever the 
+    // session; payloads too long for it were refused as they came in
+    msg::sealHeartbeat(heartbeat);
+    s_send(pub_hb_channels, heartbeat, true);
   }
 
-  delete sstream;
-
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * \file      id_registry.cpp
+ * \brief     Dense indices for the box and node IDs of this flock.
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#include "id_registry.hpp"
+
+#include <cstring>
+
+IdRegistry::IdRegistry() :
+  ids_(),
+  slots_(16, 0),
+  count_(0) {}
+
+uint32_t IdRegistry::intern(const unsigned char id[F_GENERIC_HASH_LEN]) {
+  int index = find(id);
+  if ( index >= 0 ) return static_cast<uint32_t>(index);
+
+  if ( 2 * (count_ + 1) > slots_.size() ) grow();
+  ids_.insert(ids_.end(), id, id + F_GENERIC_HASH_LEN);
+  ++count_;
+  size_t i = slot(id);
+  while ( slots_[i] != 0 ) i = (i + 1) & (slots_.size() - 1);
+  slots_[i] = count_;
+  return count_ - 1;
+}
+
+int IdRegistry::find(const unsigned char id[F_GENERIC_HASH_LEN]) const {
+  for (size_t i = slot(id); slots_[i] != 0; i = (i + 1) & (slots_.size() - 1)) {
+    const uint32_t index = slots_[i] - 1;
+    if ( std::memcmp(&ids_[index * F_GENERIC_HASH_LEN], id, F_GENERIC_HASH_LEN) == 0 )
+      return static_cast<int>(index);
+  }
+  return -1;
+}
+
+const unsigned char* IdRegistry::get(const uint32_t index) const {
+  return &ids_[index * F_GENERIC_HASH_LEN];
+}
+
+uint32_t IdRegistry::size() const {
+  return count_;
+}
+
+/**
+ * \fn IdRegistry::slot
+ *
+ * IDs are hashes themselves, but not all of them are ours to trust, so
+ * all of their bytes go into the slot rather than just the first ones.
+ */
+size_t IdRegistry::slot(const unsigned char id[F_GENERIC_HASH_LEN]) const {
+  uint64_t folded = 0;
+  for (size_t i = 0; i < F_GENERIC_HASH_LEN; i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, id + i, sizeof(word));
+    folded = (folded ^ word) * 0x9E3779B97F4A7C15ULL;
+  }
+  return static_cast<size_t>(folded >> 32) & (slots_.size() - 1);
+}
+
+void IdRegistry::grow() {
+  slots_.assign(2 * slots_.size(), 0);
+  for (uint32_t index = 0; index < count_; ++index) {
+    size_t i = slot(get(index));
+    while ( slots_[i] != 0 ) i = (i + 1) & (slots_.size() - 1);
+    slots_[i] = index + 1;
+  }
+}
@@ -96,31 +96,16 @@ int main_application(int argc, char* argv[])
   }
 
   std::cout << "main: received interrupt, broadcasting signal to boxoffice..." << std::endl;
-  std::stringstream* message = new std::stringstream();
-  *message << F_SIGTYPE_LIFE << " " << F_SIGLIFE_INTERRUPT;
-  zmqpp::message* z_msg = new zmqpp::message();
-  *z_msg << message->str();
-  z_boxoffice.send(*z_msg);
-  delete z_msg;
+  s_send(z_boxoffice, Frame(F_SIGTYPE_LIFE, F_SIGLIFE_INTERRUPT));
 
   std::cout << "main: boxoffice exited, broadcasting signal..." << std::endl;
-  message = new std::stringstream();
-  *message << F_SIGTYPE_LIFE << " " << F_SIGLIFE_INTERRUPT;
-  z_msg = new zmqpp::message();
-  *z_msg << message->str();
-  z_broadcast.send(*z_msg);
+  s_send(z_broadcast, Frame(F_SIGTYPE_LIFE, F_SIGLIFE_INTERRUPT));
 
   std::cout << "main: waiting for boxoffice to send exit..." << std::endl;
-  z_msg = new zmqpp::message();
-  z_boxoffice.receive(*z_msg);
-  std::stringstream sstream;
-  sstream << z_msg->get(0);
-  int msg_type, msg_signal;
-  sstream >> msg_type >> msg_signal;
-  delete z_msg;
-
-  sstream >> msg_type >> msg_signal;
-  if ( msg_type != F_SIGTYPE_LIFE && msg_signal != F_SIGLIFE_EXIT ) return 1;
+  zmqpp::message z_msg;
+  z_boxoffice.receive(z_msg);
+  FrameView frame = s_frame(z_msg);
+  if ( !frame.valid() || frame.type() != F_SIGTYPE_LIFE || frame.status() != F_SIGLIFE_EXIT ) return 1;
   if (F_MSG_DEBUG) printf("main: boxoffice sent exit signal, cleaning up and exiting...\n");
 
   bo_thread.join();
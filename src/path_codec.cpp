@@ -0,0 +1,70 @@
+/**
+ * \file      path_codec.cpp
+ * \brief     Wire encoding of the paths in file metadata records. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "path_codec.hpp"
+
+#include <algorithm>
+
+void PathCodec::encode(std::ostream& ostream, const std::string& path) {
+  size_t shared = 0;
+  size_t limit = std::min(path.size(), previous_.size());
+  while (shared < limit && path[shared] == previous_[shared]) ++shared;
+
+  writeVarint(ostream, shared);
+  writeVarint(ostream, path.size() - shared);
+  ostream.write(path.data() + shared, path.size() - shared);
+  previous_ = path;
+}
+
+/**
+ * \fn PathCodec::decode
+ *
+ * Reads a path written by encode(). Returns false if the record is 
+ * malformed or the path would exceed F_MAXIMUM_PATH_LENGTH. 
+ */
+bool PathCodec::decode(std::istream& istream, std::string& path) {
+  uint64_t shared, suffix;
+  if ( !readVarint(istream, shared) || !readVarint(istream, suffix)
+    || shared > previous_.size() || shared > F_MAXIMUM_PATH_LENGTH
+    || suffix > F_MAXIMUM_PATH_LENGTH - shared )
+    return false;
+
+  path.assign(previous_, 0, shared);
+  path.resize(shared + suffix);
+  istream.read(&path[shared], suffix);
+  if (static_cast<uint64_t>(istream.gcount()) != suffix) return false;
+  previous_ = path;
+  return true;
+}
+
+void PathCodec::reset() {
+  previous_.clear();
+}
+
+/**
+ * \fn PathCodec::writeVarint
+ *
+ * Writes value in seven bit groups, least significant first, with the 
+ * high bit of each byte set if more follow. 
+ */
+void PathCodec::writeVarint(std::ostream& ostream, uint64_t value) {
+  while (value >= 0x80) {
+    ostream.put(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  ostream.put(static_cast<char>(value));
+}
+bool PathCodec::readVarint(std::istream& istream, uint64_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    int c = istream.get();
+    if (c == std::char_traits<char>::eof()) return false;
+    value |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0) return true;
+  }
+  return false;
+}
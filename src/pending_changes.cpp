@@ -0,0 +1,70 @@
+/**
+ * \file      pending_changes.cpp
+ * \brief     Local changes of a box waiting to be announced.
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#include "pending_changes.hpp"
+
+PendingChanges::PendingChanges() :
+  order_(),
+  index_() {}
+
+File* PendingChanges::push_back(File* file) {
+  std::unordered_map<std::string, std::list<File*>::iterator>::iterator pending =
+    index_.find(file->getPath());
+  if ( pending != index_.end() ) {
+    File* replaced = *pending->second;
+    *pending->second = file;
+    return replaced;
+  }
+  index_.emplace(file->getPath(), order_.insert(order_.end(), file));
+  return nullptr;
+}
+
+bool PendingChanges::push_front(File* file) {
+  if ( has(file->getPath()) ) return false;
+  index_.emplace(file->getPath(), order_.insert(order_.begin(), file));
+  return true;
+}
+
+File* PendingChanges::front() const {
+  return order_.front();
+}
+
+void PendingChanges::pop_front() {
+  index_.erase(order_.front()->getPath());
+  order_.pop_front();
+}
+
+File* PendingChanges::cancel(const std::string& path, const bool keep_front) {
+  std::unordered_map<std::string, std::list<File*>::iterator>::iterator pending =
+    index_.find(path);
+  if ( pending == index_.end() ) return nullptr;
+  if ( keep_front && pending->second == order_.begin() ) return nullptr;
+  File* cancelled = *pending->second;
+  order_.erase(pending->second);
+  index_.erase(pending);
+  return cancelled;
+}
+
+bool PendingChanges::has(const std::string& path) const {
+  return index_.find(path) != index_.end();
+}
+
+bool PendingChanges::empty() const {
+  return order_.empty();
+}
+
+size_t PendingChanges::size() const {
+  return index_.size();
+}
+
+PendingChanges::const_iterator PendingChanges::begin() const {
+  return order_.begin();
+}
+
+PendingChanges::const_iterator PendingChanges::end() const {
+  return order_.end();
+}
@@ -0,0 +1,153 @@
+/**
+ * \file      prefetcher.cpp
+ * \brief     Read-ahead of outgoing file data. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "prefetcher.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+Prefetcher::Prefetcher(const int fd,
+                       const std::vector< std::pair<uint64_t, uint64_t> >& ranges) :
+  fd_(fd),
+  ranges_(ranges),
+  blocks_(F_PREFETCH_DEPTH),
+  head_(0),
+  count_(0),
+  done_(false),
+  stop_(false),
+  mutex_(),
+  filled_(),
+  released_(),
+  reader_() {
+  for (std::vector<block_t>::iterator i = blocks_.begin(); i != blocks_.end(); ++i)
+    i->data.resize(F_PREFETCH_BLOCK_SIZE);
+  reader_ = std::thread(&Prefetcher::run, this);
+}
+
+Prefetcher::~Prefetcher() {
+  stop();
+}
+
+/**
+ * \fn Prefetcher::stop
+ *
+ * Ends the reader thread. Data not yet buffered is read directly 
+ * afterwards. 
+ */
+void Prefetcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+    done_ = true;
+  }
+  released_.notify_all();
+  filled_.notify_all();
+  if (reader_.joinable()) reader_.join();
+}
+
+/**
+ * \fn Prefetcher::read
+ *
+ * Copies up to length bytes at offset, waiting for the reader thread 
+ * if the data is about to arrive. Returns the number of bytes copied, 
+ * which like pread() may be less than length, or -1 on errors of the 
+ * direct read. 
+ */
+ssize_t Prefetcher::read(void* data, const size_t length, const uint64_t offset) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  size_t copied = 0;
+  while (copied < length) {
+    filled_.wait(lock, [this]() { return count_ > 0 || done_; });
+    if (count_ == 0) break;
+
+    block_t& block = blocks_[head_];
+    uint64_t position = offset + copied;
+    if (block.offset + block.length <= position) {
+      // read past this block
+      head_ = (head_ + 1) % blocks_.size();
+      --count_;
+      released_.notify_one();
+      continue;
+    }
+    if (block.offset > position) break;
+
+    size_t n = std::min<uint64_t>(length - copied, block.offset + block.length - position);
+    std::memcpy(static_cast<char*>(data) + copied,
+                block.data.data() + (position - block.offset), n);
+    copied += n;
+  }
+  lock.unlock();
+
+  if (copied > 0) return copied;
+  return ::pread(fd_, data, length, static_cast<off_t>(offset));
+}
+
+/**
+ * \fn Prefetcher::advise
+ *
+ * Asks the kernel to start reading the given range of a file, e.g. of 
+ * the file that is to be sent next. 
+ */
+void Prefetcher::advise(const int fd, const uint64_t offset, const uint64_t length) {
+  ::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(length),
+                  POSIX_FADV_WILLNEED);
+}
+
+void Prefetcher::run() {
+  const uint64_t window = F_PREFETCH_DEPTH * F_PREFETCH_BLOCK_SIZE;
+  ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  size_t tail = 0;
+  for (std::vector< std::pair<uint64_t, uint64_t> >::iterator range = ranges_.begin();
+       range != ranges_.end(); ++range) {
+    advise(fd_, range->first, std::min(range->second - range->first, window));
+    for (uint64_t offset = range->first; offset < range->second; ) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        released_.wait(lock, [this]() { return count_ < blocks_.size() || stop_; });
+        if (stop_) return;
+      }
+
+      // the kernel reads the block after the buffered ones meanwhile
+      if (offset + window < range->second)
+        advise(fd_, offset + window,
+               std::min<uint64_t>(range->second - offset - window, F_PREFETCH_BLOCK_SIZE));
+
+      // the tail block belongs to this thread until it is counted
+      block_t& block = blocks_[tail];
+      block.offset = offset;
+      block.length = 0;
+      uint64_t length = std::min<uint64_t>(range->second - offset, F_PREFETCH_BLOCK_SIZE);
+      while (block.length < length) {
+        ssize_t r = ::pread(fd_, block.data.data() + block.length, length - block.length,
+                            static_cast<off_t>(offset + block.length));
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) break;
+        block.length += r;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (block.length == 0) {
+        // the file shrank or cannot be read, the rest is read directly
+        done_ = true;
+        filled_.notify_all();
+        return;
+      }
+      tail = (tail + 1) % blocks_.size();
+      ++count_;
+      filled_.notify_all();
+      offset += block.length;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  done_ = true;
+  filled_.notify_all();
+}
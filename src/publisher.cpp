@@ -13,12 +13,16 @@
 #include <sstream>
 #include <iostream>
 #include <boost/thread.hpp>
+#include <algorithm>
+#include <map>
 
 Publisher::Publisher(zmqpp::context* z_ctx_, host_t data_) :
   Transmitter(z_ctx_),
-  z_heartbeater(nullptr),
-  z_dispatcher(nullptr),
+  pub_hb_channel(nullptr),
+  pub_disp_channels(),
   z_publisher(nullptr),
+  authenticator(nullptr),
+  node_hash(),
   data(data_) {
     tac = (char*)"pub";
     this->connectToHeartbeater();
@@ -26,47 +30,54 @@ Publisher::Publisher(zmqpp::context* z_ctx_, host_t data_) :
 }
 
 Publisher::~Publisher() {
-  z_heartbeater->close();
-  z_dispatcher->close();
   z_publisher->close();
 
-  delete z_heartbeater;
-  delete z_dispatcher;
   delete z_publisher;
+  delete authenticator;
 }
 
 int Publisher::connectToHeartbeater()
 {
-  z_heartbeater = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pair);
-  z_heartbeater->connect("inproc://pub_hb_pair");
+  // every host has channels of its own, the rings take one consumer only
+  pub_hb_channel = s_channel("pub_hb" + data.endpoint);
 
   return 0;
 }
 
 int Publisher::connectToDispatcher()
 {
-  z_dispatcher = new zmqpp::socket(*z_ctx, zmqpp::socket_type::pair);
-  z_dispatcher->connect("inproc://pub_disp_pair");
+  std::map< std::string, box_t > boxes = Config::getInstance()->getBoxes();
+  for (std::map<std::string,box_t>::iterator i = boxes.begin(); i != boxes.end(); ++i)
+    pub_disp_channels.push_back(s_channel("pub_disp" + data.endpoint, i->second.uid));
 
   return 0;
 }
 
 int Publisher::run()
+{
+  Reactor reactor;
+  if ( attach(reactor) != 0 ) return 1;
+  reactor.run();
+
+  return 0;
+}
+
+int Publisher::attach(Reactor& reactor)
 {
   // internal check if publisher was correctly initialized
   if ( z_ctx == nullptr || data.endpoint.compare("") == 0 )
     return 1;
 
   if (F_MSG_DEBUG) printf("pub: setting up authentication...\n");
-  zmqpp::auth authenticator(*z_ctx);
-  if (F_MSG_DEBUG) authenticator.set_verbose (true);
-  authenticator.configure_domain("*");
+  authenticator = new zmqpp::auth(*z_ctx);
+  if (F_MSG_DEBUG) authenticator->set_verbose (true);
+  authenticator->configure_domain("*");
 
   Config* conf = Config::getInstance();
   std::vector<std::string> node_endpoints = conf->getNodePublicKeys();
   for (std::vector<std::string>::iterator i=node_endpoints.begin();
        i != node_endpoints.end(); ++i) {
-    authenticator.configure_curve(*i);
+    authenticator->configure_curve(*i);
   }
 
   if (F_MSG_DEBUG) printf("pub: starting pub socket and sending...\n");
@@ -76,41 +87,50 @@ int Publisher::run()
   z_publisher->set(zmqpp::socket_option::curve_secret_key, data.keypair.secret_key);
   z_publisher->bind(data.endpoint.c_str());
 
-  std::stringstream* sstream;
-  int msg_type, msg_signal;
-
-  while(true)
-  {
-    // waiting for boxoffice input in non-blocking mode
-    sstream = new std::stringstream();
-    s_recv(*z_boxoffice_push,
-           *z_broadcast,
-           *z_heartbeater,
-           *z_dispatcher,
-           *sstream);
-
-    *sstream >> msg_type >> msg_signal;
-    if ( msg_type == F_SIGTYPE_LIFE && msg_signal == F_SIGLIFE_INTERRUPT ) break;
-
-    // send a message
-    std::string infomessage = sstream->str().substr(5);
-    std::stringstream message;
-    message << std::to_string(msg_signal) << infomessage;
-    if (msg_signal != fsm::status_200 && msg_signal != fsm::status_210 )
-      if (F_MSG_DEBUG) printf("pub: sending status %d message with length %lu\n",
-          msg_signal, message.str().length());
-    // setting the width to F_MINIMUM_HB_WIDTH so all heartbeats have the same length
-    int p = message.tellp();
-    if (F_MINIMUM_HB_WIDTH-p > 0)
-      message << std::setw(F_MINIMUM_HB_WIDTH-p) << std::setfill(' ') << " ";
-    zmqpp::message z_msg;
-    z_msg << message.str();
-    z_publisher->send(z_msg);
-
-    delete sstream;
-  }
-
-  delete sstream;
+  node_hash.makeHash(data.keypair.public_key);
+  Reactor::message_handler_t control = [this](zmqpp::message& z_msg) {
+    FrameView frame = s_frame(z_msg);
+    if ( !frame.valid() ) return true;
+    if ( frame.type() == F_SIGTYPE_LIFE && frame.status() == F_SIGLIFE_INTERRUPT ) return false;
+    if ( frame.type() != F_SIGTYPE_PUB ) return true;
+
+    Frame message(frame);
+    publish(message);
+    return true;
+  };
+  // frames of the heartbeater and dispatcher are sent as they are
+  Reactor::frame_handler_t forward = [this](Frame& frame) {
+    FrameView view(frame.data(), frame.size());
+    if ( view.valid() && view.type() == F_SIGTYPE_PUB )
+      publish(frame);
+    return true;
+  };
+
+  reactor.add(*z_broadcast, control);
+  reactor.add(*z_boxoffice_push, control);
+  reactor.add(*pub_hb_channel, forward);
+  for (std::vector<FrameChannel*>::iterator i = pub_disp_channels.begin();
+       i != pub_disp_channels.end(); ++i)
+    reactor.add(**i, forward);
 
   return 0;
+}
+
+// stamps the frame with the id of this node and publishes it; every 
+// frame goes out with exactly F_HEARTBEAT_LEN, the length of a file data 
+// package as well, longer ones are refused
+void Publisher::publish(Frame& message)
+{
+  int msg_signal = FrameView(message.data(), message.size()).status();
+  if ( message.size() > F_HEARTBEAT_LEN ) {
+    std::cerr << "[E] pub: refusing status " << msg_signal << " message of "
+              << message.size() << " bytes" << std::endl;
+    return;
+  }
+  if (msg_signal != fsm::status_200 && msg_signal != fsm::status_210 )
+    if (F_MSG_DEBUG) printf("pub: sending status %d message with length %lu\n",
+        msg_signal, message.size());
+  message.setNode(node_hash.getBytes());
+  message.pad(F_HEARTBEAT_LEN);
+  s_send(*z_publisher, message);
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * \file      reactor.cpp
+ * \brief     Event loop over the sockets and file descriptors of a thread.
+ * \date      2016
+ * \copyright GNU Public License v3 or higher.
+ */
+
+#include "reactor.hpp"
+
+Reactor::Reactor() :
+  poller_(),
+  sources_(),
+  z_msg_(),
+  frame_() {}
+
+int Reactor::add(zmqpp::socket& socket, message_handler_t handler) {
+  poller_.add(socket, ZMQ_POLLIN);
+  source_t source = { &socket, nullptr, -1, handler, nullptr, nullptr, false, 0 };
+  sources_.push_back(source);
+  return static_cast<int>(sources_.size()) - 1;
+}
+
+int Reactor::add(FrameChannel& channel, frame_handler_t handler) {
+  poller_.add(channel.fd(), ZMQ_POLLIN);
+  source_t source = { nullptr, &channel, channel.fd(), nullptr, handler, nullptr, false, 0 };
+  sources_.push_back(source);
+  return static_cast<int>(sources_.size()) - 1;
+}
+
+int Reactor::add(const int fd, fd_handler_t handler) {
+  poller_.add(fd, ZMQ_POLLIN);
+  source_t source = { nullptr, nullptr, fd, nullptr, nullptr, handler, false, 0 };
+  sources_.push_back(source);
+  return static_cast<int>(sources_.size()) - 1;
+}
+
+/**
+ * \fn Reactor::receive
+ *
+ * Serves the sources found ready by the last poll first, the earlier
+ * ones before the later ones; a socket or channel stays ready until it 
+ * has no more messages or used up its batch. Only then the reactor 
+ * polls again. A channel left with frames wakes the reactor again 
+ * right away. 
+ */
+int Reactor::receive(zmqpp::message& z_msg, FrameView& frame, const long timeout) {
+  while (true) {
+    for (size_t i = 0; i < sources_.size(); ++i) {
+      source_t& source = sources_[i];
+      if ( !source.ready ) continue;
+      if ( source.channel != nullptr ) {
+        if ( source.batch == 0 ) source.channel->clearWakeup();
+        if ( source.batch < F_REACTOR_BATCH && source.channel->pop(frame_) ) {
+          ++source.batch;
+          frame = FrameView(frame_.data(), frame_.size());
+          return static_cast<int>(i);
+        }
+        if ( !source.channel->empty() ) source.channel->signal();
+      } else if ( source.socket == nullptr ) {
+        source.ready = false;
+        return static_cast<int>(i);
+      } else if ( source.batch < F_REACTOR_BATCH && source.socket->receive(z_msg, true) ) {
+        ++source.batch;
+        frame = s_frame(z_msg);
+        return static_cast<int>(i);
+      }
+      source.ready = false;
+    }
+
+    if ( !poller_.poll(timeout) ) return -1;
+    for (size_t i = 0; i < sources_.size(); ++i) {
+      source_t& source = sources_[i];
+      source.ready = source.socket != nullptr ? poller_.has_input(*source.socket)
+                                              : poller_.has_input(source.fd);
+      source.batch = 0;
+    }
+  }
+}
+
+int Reactor::receive(zmqpp::message& z_msg, const long timeout) {
+  FrameView frame;
+  return receive(z_msg, frame, timeout);
+}
+
+void Reactor::run() {
+  FrameView frame;
+  while (true) {
+    int i = receive(z_msg_, frame);
+    if ( i < 0 ) continue;
+    source_t& source = sources_[i];
+    bool go_on = true;
+    if ( source.socket != nullptr ) {
+      if ( source.on_message ) go_on = source.on_message(z_msg_);
+    } else if ( source.channel != nullptr ) {
+      if ( source.on_frame ) go_on = source.on_frame(frame_);
+    } else if ( source.on_ready ) {
+      go_on = source.on_ready();
+    }
+    if ( !go_on ) return;
+  }
+}
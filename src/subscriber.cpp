@@ -12,6 +12,7 @@
 #include <sstream>
 #include <iostream>
 #include <boost/thread.hpp>
+#include <cstring>
 
 Subscriber::Subscriber(zmqpp::context* z_ctx_, node_t data_) :
   Transmitter(z_ctx_), 
@@ -27,6 +28,15 @@ Subscriber::~Subscriber()
 }
 
 int Subscriber::run()
+{
+  Reactor reactor;
+  if ( attach(reactor) != 0 ) return 1;
+  reactor.run();
+
+  return 0;
+}
+
+int Subscriber::attach(Reactor& reactor)
 {
   // internal check if subscriber was correctly initialized
   if ( z_ctx == nullptr || data.endpoint.compare("") == 0
@@ -43,37 +53,24 @@ int Subscriber::run()
   z_subscriber->connect(data.endpoint.c_str());
   z_subscriber->subscribe("");
 
-  std::stringstream* sstream;
-  int msg_type, msg_signal;
-  std::string infomessage;
-
-  while (true)
-  {
-    sstream = new std::stringstream();
-    s_recv(*z_boxoffice_push, *z_broadcast, *z_subscriber, *sstream);
-    *sstream >> msg_type;
-    if ( msg_type == F_SIGTYPE_LIFE ) {
-      *sstream >> msg_signal;
-      if ( msg_signal == F_SIGLIFE_INTERRUPT ) break;
-    } else {
-      msg_signal = msg_type;
-    }
-
-    std::string infomessage = sstream->str().substr(3);
-    std::stringstream message;
-    message << F_SIGTYPE_SUB << " "
-            << msg_signal;
-    message.write(reinterpret_cast<char*>(
-                    const_cast<unsigned char*>(data.uid)
-                  ), F_GENERIC_HASH_LEN);
-    message << infomessage;
-    zmqpp::message z_msg;
-    z_msg << message.str();
-    z_boxoffice_pull->send(z_msg);
+  Reactor::message_handler_t control = [](zmqpp::message& z_msg) {
+    FrameView frame = s_frame(z_msg);
+    return !( frame.valid() && frame.type() == F_SIGTYPE_LIFE
+           && frame.status() == F_SIGLIFE_INTERRUPT );
+  };
+  // only frames published by the node this subscriber listens to are
+  // forwarded, and they are forwarded as they are
+  Reactor::message_handler_t forward = [this](zmqpp::message& z_msg) {
+    FrameView frame = s_frame(z_msg);
+    if ( frame.valid() && frame.type() == F_SIGTYPE_PUB
+      && std::memcmp(frame.node(), data.uid, F_GENERIC_HASH_LEN) == 0 )
+      z_boxoffice_pull->send(z_msg);
+    return true;
+  };
 
-    delete sstream;
-  }
-  delete sstream;
+  reactor.add(*z_broadcast, control);
+  reactor.add(*z_boxoffice_push, control);
+  reactor.add(*z_subscriber, forward);
 
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * \file      sync_queue.cpp
+ * \brief     Groups the fsyncs of received files. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "sync_queue.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <cerrno>
+#include <cstring>
+#include <chrono>
+#include <set>
+#include <string>
+#include <iostream>
+
+SyncQueue::~SyncQueue() {
+  flush();
+}
+
+void SyncQueue::setInterval(uint32_t interval) {
+  interval_ = interval;
+}
+
+void SyncQueue::add(int fd, const boost::filesystem::path& target) {
+  add(fd, boost::filesystem::path(), target);
+}
+void SyncQueue::add(int fd,
+                    const boost::filesystem::path& staging,
+                    const boost::filesystem::path& target) {
+  entry_t entry;
+  entry.fd = fd;
+  entry.staging = staging;
+  entry.target = target;
+  pending_.push_back(entry);
+
+  if (interval_ == 0) flush();
+}
+
+void SyncQueue::flushIfDue() {
+  if (pending_.empty()) return;
+
+  uint64_t timestamp =
+    std::chrono::duration_cast< std::chrono::milliseconds >(
+      std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+  if (timestamp - last_flush_ >= interval_) flush();
+}
+
+/**
+ * \fn SyncQueue::flush
+ *
+ * Syncs all pending files, then renames the staged ones over their 
+ * targets and finally syncs every directory that received a rename, 
+ * each one only once. A staged file is only ever renamed after its 
+ * data is on disk, so a crash leaves either the old or the new file. 
+ */
+void SyncQueue::flush() {
+  std::set<std::string> directories;
+
+  for (std::vector<entry_t>::iterator i = pending_.begin();
+       i != pending_.end(); ++i) {
+    if (::fsync(i->fd) != 0)
+      std::cerr << "[E] could not sync " << i->target.string() << ": "
+                << std::strerror(errno) << std::endl;
+    ::close(i->fd);
+
+    if (i->staging.empty()) continue;
+
+    int ret = ::renameat2(AT_FDCWD, i->staging.c_str(),
+                          AT_FDCWD, i->target.c_str(), 0);
+    if (ret != 0 && (errno == ENOSYS || errno == EINVAL))
+      ret = ::rename(i->staging.c_str(), i->target.c_str());
+    if (ret != 0) {
+      std::cerr << "[E] could not move " << i->staging.string() << " to "
+                << i->target.string() << ": " << std::strerror(errno)
+                << std::endl;
+      ::unlink(i->staging.c_str());
+      continue;
+    }
+    directories.insert(i->target.parent_path().string());
+  }
+  pending_.clear();
+
+  for (std::set<std::string>::iterator i = directories.begin();
+       i != directories.end(); ++i) {
+    int dir_fd = ::open(i->c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd < 0) continue;
+    ::fsync(dir_fd);
+    ::close(dir_fd);
+  }
+
+  last_flush_ =
+    std::chrono::duration_cast< std::chrono::milliseconds >(
+      std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
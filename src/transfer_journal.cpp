@@ -0,0 +1,257 @@
+/**
+ * \file      transfer_journal.cpp
+ * \brief     Persistent per-chunk completion state of a received file. 
+ * \date      2016
+ * \copyright GNU Public License v3 or higher. 
+ */
+
+#include "transfer_journal.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <endian.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+
+#include "constants.hpp"
+
+namespace {
+  const char     journal_magic[4] = { 'F', 'L', 'J', '1' };
+  const uint64_t journal_header_size = 4 + 8 + 4 + 4 + F_GENERIC_HASH_LEN;
+}
+
+TransferJournal::TransferJournal(const std::string& journal_dir,
+                                 const unsigned char box_hash[F_GENERIC_HASH_LEN],
+                                 const std::string& path) :
+  journal_path_(),
+  fd_(-1),
+  size_(0),
+  mtime_(0),
+  content_hash_(),
+  chunk_count_(0),
+  missing_(0),
+  bitmap_(),
+  partial_(),
+  dirty_begin_(0),
+  dirty_end_(0),
+  unsynced_(0) {
+  // journals are named after the box and the path of the file
+  std::string key(reinterpret_cast<const char*>(box_hash), F_GENERIC_HASH_LEN);
+  key += path;
+  boost::filesystem::path dir(journal_dir);
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(dir, ec);
+  journal_path_ = (dir / (Hash(key).getString() + ".journal")).string();
+}
+TransferJournal::~TransferJournal() {
+  sync();
+  if (fd_ >= 0) ::close(fd_);
+}
+
+/**
+ * \fn TransferJournal::open
+ *
+ * Opens the journal for a file with the given identity. If a journal 
+ * for exactly this identity already exists, its bitmap is loaded and 
+ * true is returned, i.e. the transfer can be resumed. Otherwise a new 
+ * journal with no completed chunks is written and false is returned. 
+ */
+bool TransferJournal::open(const uint64_t size,
+                           const uint32_t mtime,
+                           const unsigned char content_hash[F_GENERIC_HASH_LEN]) {
+  size_ = size;
+  mtime_ = mtime;
+  std::memcpy(content_hash_, content_hash, F_GENERIC_HASH_LEN);
+  chunk_count_ = (size_ + F_MAXIMUM_FILE_PACKAGE_SIZE - 1) / F_MAXIMUM_FILE_PACKAGE_SIZE;
+  bitmap_.assign((chunk_count_ + 7) / 8, 0);
+  partial_.clear();
+
+  if (fd_ < 0)
+    fd_ = ::open(journal_path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd_ < 0) return false;
+
+  char header[journal_header_size];
+  if (::pread(fd_, header, journal_header_size, 0)
+        == static_cast<ssize_t>(journal_header_size)) {
+    uint64_t j_size;
+    uint32_t j_mtime, j_chunk_size;
+    std::memcpy(&j_size, header + 4, 8);
+    std::memcpy(&j_mtime, header + 12, 4);
+    std::memcpy(&j_chunk_size, header + 16, 4);
+    if ( std::memcmp(header, journal_magic, 4) == 0
+      && be64toh(j_size) == size_
+      && be32toh(j_mtime) == mtime_
+      && be32toh(j_chunk_size) == F_MAXIMUM_FILE_PACKAGE_SIZE
+      && std::memcmp(header + 20, content_hash_, F_GENERIC_HASH_LEN) == 0
+      && ::pread(fd_, bitmap_.data(), bitmap_.size(), journal_header_size)
+           == static_cast<ssize_t>(bitmap_.size()) ) {
+      missing_ = 0;
+      for (uint64_t i = 0; i < chunk_count_; ++i)
+        if (!hasChunk(i)) ++missing_;
+      return true;
+    }
+  }
+
+  reset();
+  return false;
+}
+
+/**
+ * \fn TransferJournal::reset
+ *
+ * Marks all chunks as missing and rewrites the journal. 
+ */
+void TransferJournal::reset() {
+  std::fill(bitmap_.begin(), bitmap_.end(), 0);
+  partial_.clear();
+  missing_ = chunk_count_;
+  dirty_begin_ = dirty_end_ = unsynced_ = 0;
+  if (fd_ < 0) return;
+
+  char header[journal_header_size];
+  uint64_t size_be = htobe64(size_);
+  uint32_t mtime_be = htobe32(mtime_);
+  uint32_t chunk_size_be = htobe32(F_MAXIMUM_FILE_PACKAGE_SIZE);
+  std::memcpy(header, journal_magic, 4);
+  std::memcpy(header + 4, &size_be, 8);
+  std::memcpy(header + 12, &mtime_be, 4);
+  std::memcpy(header + 16, &chunk_size_be, 4);
+  std::memcpy(header + 20, content_hash_, F_GENERIC_HASH_LEN);
+
+  if (::ftruncate(fd_, 0) != 0
+   || ::pwrite(fd_, header, journal_header_size, 0)
+        != static_cast<ssize_t>(journal_header_size)
+   || ::pwrite(fd_, bitmap_.data(), bitmap_.size(), journal_header_size)
+        != static_cast<ssize_t>(bitmap_.size())) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+}
+
+/**
+ * \fn TransferJournal::remove
+ *
+ * Deletes the journal once the file has been completely received. 
+ */
+void TransferJournal::remove() {
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  ::unlink(journal_path_.c_str());
+  dirty_begin_ = dirty_end_ = unsynced_ = 0;
+}
+
+/**
+ * \fn TransferJournal::sync
+ *
+ * Writes back the part of the bitmap that changed since the last sync. 
+ */
+void TransferJournal::sync() {
+  if (fd_ < 0 || dirty_begin_ >= dirty_end_) return;
+
+  if (::pwrite(fd_, bitmap_.data() + dirty_begin_, dirty_end_ - dirty_begin_,
+               journal_header_size + dirty_begin_) < 0) return;
+  dirty_begin_ = dirty_end_ = unsynced_ = 0;
+}
+
+void TransferJournal::markRange(const uint64_t offset, const uint64_t length) {
+  if (length == 0 || offset >= size_) return;
+
+  uint64_t end = std::min(offset + length, size_);
+  uint64_t pos = offset;
+  while (pos < end) {
+    uint64_t index = pos / F_MAXIMUM_FILE_PACKAGE_SIZE;
+    uint64_t chunk_end = std::min((index + 1) * F_MAXIMUM_FILE_PACKAGE_SIZE, size_);
+    uint64_t covered = std::min(end, chunk_end) - pos;
+
+    if (!hasChunk(index)) {
+      if (covered == getChunkLength(index)) {
+        markChunk(index);
+      } else {
+        // ranges never overlap, so counting the bytes is sufficient
+        uint64_t& received = partial_[index];
+        received += covered;
+        if (received >= getChunkLength(index)) {
+          partial_.erase(index);
+          markChunk(index);
+        }
+      }
+    }
+    pos += covered;
+  }
+}
+
+void TransferJournal::markChunk(const uint64_t index) {
+  bitmap_[index / 8] |= static_cast<uint8_t>(1 << (index % 8));
+  --missing_;
+
+  if (dirty_begin_ >= dirty_end_) {
+    dirty_begin_ = index / 8;
+    dirty_end_ = index / 8 + 1;
+  } else {
+    dirty_begin_ = std::min(dirty_begin_, index / 8);
+    dirty_end_ = std::max(dirty_end_, index / 8 + 1);
+  }
+  if (++unsynced_ >= F_JOURNAL_SYNC_CHUNKS) sync();
+}
+
+bool TransferJournal::hasChunk(const uint64_t index) const {
+  if (index >= chunk_count_) return false;
+  return (bitmap_[index / 8] & (1 << (index % 8))) != 0;
+}
+bool TransferJournal::complete() const {
+  return missing_ == 0;
+}
+
+uint64_t TransferJournal::getChunkCount() const {
+  return chunk_count_;
+}
+uint64_t TransferJournal::getMissingChunkCount() const {
+  return missing_;
+}
+const unsigned char* TransferJournal::getContentHash() const {
+  return content_hash_;
+}
+uint64_t TransferJournal::getChunkLength(const uint64_t index) const {
+  uint64_t begin = index * F_MAXIMUM_FILE_PACKAGE_SIZE;
+  return std::min<uint64_t>(F_MAXIMUM_FILE_PACKAGE_SIZE, size_ - begin);
+}
+
+/**
+ * \fn TransferJournal::getMissingRanges
+ *
+ * Returns the missing parts of the file as byte ranges [begin, end). 
+ * At most max_ranges ranges are returned; if there are more, the last 
+ * range is extended to the end of the file. 
+ */
+std::vector< std::pair<uint64_t, uint64_t> >
+  TransferJournal::getMissingRanges(const size_t max_ranges) const {
+  std::vector< std::pair<uint64_t, uint64_t> > ranges;
+  if (max_ranges == 0) return ranges;
+
+  uint64_t i = 0;
+  while (i < chunk_count_) {
+    if (hasChunk(i)) {
+      ++i;
+      continue;
+    }
+    uint64_t begin = i;
+    while (i < chunk_count_ && !hasChunk(i)) ++i;
+
+    if (ranges.size() + 1 == max_ranges && missing_ > 0) {
+      // out of ranges, the rest has to be sent completely
+      uint64_t j = i;
+      while (j < chunk_count_ && hasChunk(j)) ++j;
+      if (j < chunk_count_) {
+        ranges.push_back(std::make_pair(begin * F_MAXIMUM_FILE_PACKAGE_SIZE, size_));
+        break;
+      }
+    }
+    ranges.push_back(std::make_pair(begin * F_MAXIMUM_FILE_PACKAGE_SIZE,
+                                    std::min(i * F_MAXIMUM_FILE_PACKAGE_SIZE, size_)));
+  }
+  return ranges;
+}
@@ -67,11 +67,7 @@ int Transmitter::connectToBoxoffice()
 
   // send a heartbeat to boxoffice, so it knows the heartbeater is ready
   if (F_MSG_DEBUG) printf("%s: sending heartbeat...\n", tac);
-  std::stringstream message;
-  message << F_SIGTYPE_LIFE << " " << F_SIGLIFE_ALIVE;
-  zmqpp::message z_msg;
-  z_msg << message.str();
-  z_boxoffice_pull->send(z_msg);
+  s_send(*z_boxoffice_pull, Frame(F_SIGTYPE_LIFE, F_SIGLIFE_ALIVE));
 
   return 0;
 }
@@ -80,11 +76,7 @@ int Transmitter::sendExitSignal()
 {
   // send exit signal to boxoffice
   if (F_MSG_DEBUG) printf("%s: sending exit signal...\n", tac);
-  std::stringstream message;
-  message << F_SIGTYPE_LIFE << " " << F_SIGLIFE_EXIT;
-  zmqpp::message z_msg;
-  z_msg << message.str();
-  z_boxoffice_pull->send(z_msg);
+  s_send(*z_boxoffice_pull, Frame(F_SIGTYPE_LIFE, F_SIGLIFE_EXIT));
 
   if (F_MSG_DEBUG) printf("%s: signal sent, exiting...\n", tac);
 
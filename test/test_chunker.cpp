@@ -0,0 +1,123 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+
+#include "chunker.hpp"
+
+namespace {
+  std::string makeRandomContent(size_t length, unsigned int seed) {
+    std::string content(length, '\0');
+    std::srand(seed);
+    for (size_t i = 0; i < length; ++i)
+      content[i] = static_cast<char>(std::rand() & 0xff);
+    return content;
+  }
+
+  boost::filesystem::path writeTemporaryFile(const std::string& content) {
+    boost::filesystem::path path = boost::filesystem::temp_directory_path()
+      / boost::filesystem::unique_path("flocksy-chunker-%%%%-%%%%");
+    std::ofstream out(path.string(), std::ios::binary);
+    out << content;
+    return path;
+  }
+
+  std::vector<Chunk> chunkFile(const boost::filesystem::path& path, uint64_t size) {
+    std::vector<Chunk> chunks;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    Chunker chunker(fd, size);
+    Chunk chunk;
+    while (chunker.next(chunk, nullptr))
+      chunks.push_back(chunk);
+    ::close(fd);
+    return chunks;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(chunker_boundaries)
+{
+  std::string content = makeRandomContent(1000000, 1);
+  boost::filesystem::path path = writeTemporaryFile(content);
+  std::vector<Chunk> chunks = chunkFile(path, content.size());
+
+  uint64_t offset = 0;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    BOOST_CHECK_EQUAL( chunks[i].offset, offset );
+    BOOST_CHECK( chunks[i].length <= F_CDC_MAXIMUM_CHUNK_SIZE );
+    if (i + 1 < chunks.size())
+      BOOST_CHECK( chunks[i].length > F_CDC_MINIMUM_CHUNK_SIZE );
+    offset += chunks[i].length;
+  }
+  BOOST_CHECK_EQUAL( offset, content.size() );
+  // roughly the average chunk size
+  BOOST_CHECK( chunks.size() > content.size() / (4 * F_CDC_AVERAGE_CHUNK_SIZE) );
+  BOOST_CHECK( chunks.size() < content.size() / (F_CDC_AVERAGE_CHUNK_SIZE / 4) );
+
+  boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(chunker_insertion)
+{
+  std::string content = makeRandomContent(1000000, 2);
+  std::string modified = content.substr(0, 500000) + "x" + content.substr(500000);
+  boost::filesystem::path path = writeTemporaryFile(content);
+  boost::filesystem::path modified_path = writeTemporaryFile(modified);
+  std::vector<Chunk> chunks = chunkFile(path, content.size());
+  std::vector<Chunk> modified_chunks = chunkFile(modified_path, modified.size());
+
+  std::set<std::string> hashes;
+  for (size_t i = 0; i < chunks.size(); ++i)
+    hashes.insert(std::string(reinterpret_cast<char*>(chunks[i].hash), F_GENERIC_HASH_LEN));
+  size_t changed = 0;
+  for (size_t i = 0; i < modified_chunks.size(); ++i)
+    if (hashes.count(std::string(reinterpret_cast<char*>(modified_chunks[i].hash),
+                                 F_GENERIC_HASH_LEN)) == 0)
+      ++changed;
+  // an inserted byte only changes the chunks around it
+  BOOST_CHECK( changed <= 2 );
+
+  boost::filesystem::remove(path);
+  boost::filesystem::remove(modified_path);
+}
+
+BOOST_AUTO_TEST_CASE(chunk_store_lookup)
+{
+  boost::filesystem::path store_dir = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-chunks-%%%%-%%%%");
+  ChunkStore* store = ChunkStore::getInstance();
+  store->setDirectory(store_dir.string());
+
+  std::string content = makeRandomContent(200000, 3);
+  boost::filesystem::path path = writeTemporaryFile(content);
+  int fd = ::open(path.c_str(), O_RDONLY);
+  store->addFile(fd, content.size(), path.string());
+  ::close(fd);
+
+  std::vector<Chunk> chunks = chunkFile(path, content.size());
+  std::vector<char> data;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    BOOST_CHECK( store->has(chunks[i].hash) );
+    BOOST_REQUIRE( store->get(chunks[i].hash, chunks[i].length, data) );
+    BOOST_CHECK( std::memcmp(data.data(), content.data() + chunks[i].offset,
+                             chunks[i].length) == 0 );
+  }
+
+  // once the file changed, its entries are stale and get dropped
+  {
+    std::ofstream out(path.string(), std::ios::binary | std::ios::trunc);
+    out << makeRandomContent(200000, 4);
+  }
+  BOOST_CHECK( !store->get(chunks[0].hash, chunks[0].length, data) );
+  BOOST_CHECK( !store->has(chunks[0].hash) );
+
+  store->setDirectory("");
+  boost::filesystem::remove(path);
+  boost::filesystem::remove_all(store_dir);
+}
@@ -0,0 +1,45 @@
+#include <boost/test/unit_test.hpp>
+
+#include "clock_sync.hpp"
+#include "constants.hpp"
+
+BOOST_AUTO_TEST_CASE(clock_sync_filter)
+{
+  ClockSync clock;
+  BOOST_CHECK( !clock.has(1) );
+  BOOST_CHECK_EQUAL( clock.getOffset(1), 0 );
+
+  // the node is 100 ms behind, heartbeats take 10 ms each way
+  clock.addSample(1, 110, -90);
+  BOOST_CHECK( clock.has(1) );
+  BOOST_CHECK_EQUAL( clock.getOffset(1), 100 );
+  BOOST_CHECK_EQUAL( clock.getDelay(1), 20 );
+
+  // a queued heartbeat does not move the estimate
+  clock.addSample(1, 510, -90);
+  BOOST_CHECK_EQUAL( clock.getOffset(1), 100 );
+  BOOST_CHECK_EQUAL( clock.getDelay(1), 20 );
+
+  // until it has left the window
+  for (int i = 1; i < F_CLOCK_SYNC_WINDOW; ++i)
+    clock.addSample(1, 130, -70);
+  BOOST_CHECK_EQUAL( clock.getOffset(1), 100 );
+  BOOST_CHECK_EQUAL( clock.getDelay(1), 60 );
+}
+
+BOOST_AUTO_TEST_CASE(clock_sync_consensus)
+{
+  ClockSync clock;
+  BOOST_CHECK_EQUAL( clock.getConsensusOffset(), 0 );
+
+  // clocks of 0, -100 and +40000 ms: the median is our own
+  clock.addSample(1, 100, -100);
+  clock.addSample(2, -40000, 40000);
+  BOOST_CHECK_EQUAL( clock.getConsensusOffset(), 0 );
+
+  // with -100 added the median is between 0 and -100
+  clock.addSample(3, 100, -100);
+  BOOST_CHECK_EQUAL( clock.getConsensusOffset(), 50 );
+  BOOST_CHECK_EQUAL( clock.toFlockTime(1000), 950 );
+  BOOST_CHECK_EQUAL( clock.toLocalTime(clock.toFlockTime(1000)), 1000 );
+}
@@ -0,0 +1,40 @@
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "compression.hpp"
+
+BOOST_AUTO_TEST_CASE(compression_roundtrip) {
+  std::string text;
+  while (text.size() < F_COMPRESSION_MAXIMUM_INPUT + 1000)
+    text += "flocksy synchronizes boxes of files between nodes; " + std::to_string(text.size());
+
+  std::string packed;
+  uint64_t length = Compression::pack(text.data(), text.size(), packed);
+  BOOST_CHECK(length > F_MAXIMUM_FILE_PACKAGE_SIZE);
+  BOOST_CHECK(length <= F_COMPRESSION_MAXIMUM_INPUT);
+  BOOST_CHECK(packed.size() <= F_MAXIMUM_FILE_PACKAGE_SIZE);
+
+  std::vector<char> unpacked(length);
+  BOOST_CHECK(Compression::unpack(packed.data(), packed.size(), unpacked.data(), length));
+  BOOST_CHECK(std::string(unpacked.data(), length) == text.substr(0, length));
+
+  // a wrong length is detected
+  BOOST_CHECK(!Compression::unpack(packed.data(), packed.size(), unpacked.data(), length - 1));
+}
+
+BOOST_AUTO_TEST_CASE(compression_incompressible) {
+  std::string content(F_COMPRESSION_MAXIMUM_INPUT, '\0');
+  std::srand(42);
+  for (size_t i = 0; i < content.size(); ++i)
+    content[i] = static_cast<char>(std::rand() & 0xff);
+
+  std::string packed;
+  BOOST_CHECK_EQUAL(Compression::pack(content.data(), content.size(), packed), 0);
+
+  // data fitting a single package is never packed
+  std::string text(F_MAXIMUM_FILE_PACKAGE_SIZE, 'a');
+  BOOST_CHECK_EQUAL(Compression::pack(text.data(), text.size(), packed), 0);
+}
@@ -0,0 +1,100 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <utility>
+
+#include "content_hasher.hpp"
+
+namespace {
+  hash_job_t* waitForJob(ContentHasher& hasher) {
+    hash_job_t* job = nullptr;
+    struct pollfd results = { hasher.fd(), POLLIN, 0 };
+    while (!hasher.take(job)) {
+      if (::poll(&results, 1, 5000) <= 0) return nullptr;
+      hasher.clearWakeup();
+    }
+    return job;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(content_hasher_sparse) {
+  boost::filesystem::path box_dir = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-hasher-%%%%-%%%%");
+  boost::filesystem::path journal_dir = box_dir / ".journal";
+  boost::filesystem::create_directories(box_dir);
+  Hash box_hash;
+
+  // data, a large hole and data again
+  const uint64_t size = 16 * F_MINIMUM_HOLE_SIZE;
+  {
+    int fd = ::open((box_dir / "sparse").c_str(), O_WRONLY | O_CREAT, 0600);
+    BOOST_REQUIRE( fd >= 0 );
+    std::string data(F_MINIMUM_HOLE_SIZE, 'a');
+    BOOST_REQUIRE( ::pwrite(fd, data.data(), data.size(), 0) == static_cast<ssize_t>(data.size()) );
+    BOOST_REQUIRE( ::pwrite(fd, data.data(), data.size(), size - data.size())
+                   == static_cast<ssize_t>(data.size()) );
+    ::close(fd);
+  }
+  std::stringstream record;
+  File file(box_dir.string(), &box_hash, "/sparse");
+  record << file;
+
+  ContentHasher hasher;
+  hasher.start();
+
+  hash_job_t* job = new hash_job_t();
+  job->kind = hash_job_t::hash;
+  job->box_dir = box_dir.string();
+  job->box_hash = &box_hash;
+  job->record = record.str();
+  job->max_holes = F_MAXIMUM_HOLE_RANGES;
+  BOOST_REQUIRE( hasher.submit(job) );
+  BOOST_REQUIRE( waitForJob(hasher) == job );
+  BOOST_CHECK( job->ok );
+  BOOST_CHECK( job->holes == file.getHoles(F_MAXIMUM_HOLE_RANGES) );
+
+  // the hash covers the announced holes, so it depends on them
+  unsigned char content_hash[F_GENERIC_HASH_LEN];
+  file.setHoles(job->holes);
+  file.getContentHash(content_hash);
+  BOOST_CHECK( std::memcmp(content_hash, job->content_hash, F_GENERIC_HASH_LEN) == 0 );
+
+  // the received file verifies against the announced hash with the 
+  // announced holes only
+  for (int announced = 1; announced >= 0; --announced) {
+    hash_job_t* verify = new hash_job_t();
+    verify->kind = hash_job_t::verify;
+    verify->box_hash = &box_hash;
+    verify->file = new File(box_dir.string(), &box_hash, "/sparse");
+    verify->journal = new TransferJournal(journal_dir.string(), box_hash.getBytes(), "/sparse");
+    verify->journal->open(size, file.getMtime(), job->content_hash);
+    if (announced) verify->holes = job->holes;
+    BOOST_REQUIRE( hasher.submit(verify) );
+    BOOST_REQUIRE( waitForJob(hasher) == verify );
+    BOOST_CHECK( verify->ok == (announced || job->holes.empty()) );
+    BOOST_CHECK_EQUAL( verify->signature.getSize(), size );
+    verify->journal->remove();
+    delete verify->journal;
+    delete verify->file;
+    delete verify;
+  }
+  delete job;
+
+  // cancelled jobs come back untouched
+  job = new hash_job_t();
+  job->cancelled = true;
+  BOOST_REQUIRE( hasher.submit(job) );
+  BOOST_REQUIRE( waitForJob(hasher) == job );
+  BOOST_CHECK( !job->ok );
+  delete job;
+
+  hasher.stop();
+  boost::filesystem::remove_all(box_dir);
+}
@@ -0,0 +1,154 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "delta.hpp"
+
+namespace {
+  std::string makeContent(size_t length, unsigned int seed) {
+    std::string content(length, '\0');
+    std::srand(seed);
+    for (size_t i = 0; i < length; ++i)
+      content[i] = static_cast<char>(std::rand() & 0xff);
+    return content;
+  }
+
+  Signature makeSignature(const std::string& content) {
+    Signature signature;
+    signature.begin(content.size(), 0);
+    signature.update(reinterpret_cast<const unsigned char*>(content.data()), content.size());
+    signature.finish();
+    return signature;
+  }
+
+  // encodes new_content against the signature of old_content and applies
+  // the delta to old_content in place, returns the number of literal bytes
+  uint64_t applyDelta(std::string& content,
+                      const std::string& new_content,
+                      const bool in_place) {
+    boost::filesystem::path path = boost::filesystem::temp_directory_path()
+      / boost::filesystem::unique_path("flocksy-delta-%%%%-%%%%");
+    {
+      std::ofstream out(path.string(), std::ios::binary);
+      out << new_content;
+    }
+    Signature base = makeSignature(content);
+    std::string old_content = content;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    DeltaEncoder encoder(fd, new_content.size(), 0, base, in_place);
+
+    uint64_t literal_bytes = 0;
+    uint64_t expected_offset = 0;
+    content.resize(std::max(content.size(), new_content.size()));
+    DeltaInstruction instruction;
+    while (encoder.next(instruction)) {
+      BOOST_CHECK_EQUAL( instruction.offset, expected_offset );
+      expected_offset += instruction.length;
+      if (instruction.op == DeltaInstruction::literal) {
+        BOOST_CHECK( instruction.length <= F_MAXIMUM_FILE_PACKAGE_SIZE );
+        content.replace(instruction.offset, instruction.length, instruction.data);
+        literal_bytes += instruction.length;
+      } else if (in_place) {
+        BOOST_CHECK( instruction.source >= instruction.offset );
+        for (uint64_t i = 0; i < instruction.length; ++i)
+          content[instruction.offset + i] = content[instruction.source + i];
+      } else {
+        content.replace(instruction.offset, instruction.length,
+                        old_content, instruction.source, instruction.length);
+      }
+    }
+    content.resize(new_content.size());
+    ::close(fd);
+
+    Signature expected = makeSignature(new_content);
+    BOOST_CHECK( std::memcmp(encoder.getSignature().getContentHash(),
+                             expected.getContentHash(), F_GENERIC_HASH_LEN) == 0 );
+    BOOST_CHECK_EQUAL( encoder.getSignature().getBlockCount(), expected.getBlockCount() );
+    boost::filesystem::remove(path);
+    return literal_bytes;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(delta_rolling_checksum)
+{
+  std::string content = makeContent(5000, 1);
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(content.data());
+  uint32_t weak = Signature::weakChecksum(data, 1024);
+  for (size_t i = 1; i + 1024 <= content.size(); ++i) {
+    weak = Signature::rollChecksum(weak, data[i-1], data[i+1023], 1024);
+    BOOST_REQUIRE_EQUAL( weak, Signature::weakChecksum(data + i, 1024) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(delta_append)
+{
+  std::string old_content = makeContent(1000000, 2);
+  std::string new_content = old_content + makeContent(1024, 3);
+  std::string content = old_content;
+  uint64_t literal_bytes = applyDelta(content, new_content, true);
+  BOOST_CHECK( content == new_content );
+  // the appended data and at most the old last block
+  BOOST_CHECK( literal_bytes <= 1024 + Signature::getBlockSize(old_content.size()) );
+}
+
+BOOST_AUTO_TEST_CASE(delta_edits)
+{
+  std::string old_content = makeContent(300000, 4);
+
+  // changed bytes in the middle
+  std::string new_content = old_content;
+  new_content.replace(150000, 100, makeContent(100, 5));
+  std::string content = old_content;
+  uint64_t literal_bytes = applyDelta(content, new_content, true);
+  BOOST_CHECK( content == new_content );
+  BOOST_CHECK( literal_bytes <= 2 * Signature::getBlockSize(old_content.size()) );
+
+  // removed data shifts the rest towards the start, which works in place
+  new_content = old_content.substr(0, 1000) + old_content.substr(60000);
+  content = old_content;
+  literal_bytes = applyDelta(content, new_content, true);
+  BOOST_CHECK( content == new_content );
+  BOOST_CHECK( literal_bytes <= 2 * Signature::getBlockSize(old_content.size()) );
+
+  // inserted data can only be copied from the old version if it is kept
+  new_content = old_content.substr(0, 1000) + makeContent(777, 6) + old_content.substr(1000);
+  content = old_content;
+  literal_bytes = applyDelta(content, new_content, false);
+  BOOST_CHECK( content == new_content );
+  BOOST_CHECK( literal_bytes <= 777 + 2 * Signature::getBlockSize(old_content.size()) );
+  content = old_content;
+  applyDelta(content, new_content, true);
+  BOOST_CHECK( content == new_content );
+
+  // an empty new version
+  content = old_content;
+  applyDelta(content, std::string(), true);
+  BOOST_CHECK( content.empty() );
+}
+
+BOOST_AUTO_TEST_CASE(delta_signature_file)
+{
+  boost::filesystem::path path = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-signature-%%%%-%%%%");
+  std::string content = makeContent(100000, 7);
+  Signature signature = makeSignature(content);
+  BOOST_REQUIRE( signature.save(path.string()) );
+
+  Signature loaded;
+  BOOST_REQUIRE( loaded.load(path.string()) );
+  BOOST_CHECK( loaded.matches(content.size(), 0) );
+  BOOST_CHECK_EQUAL( loaded.getBlockCount(), signature.getBlockCount() );
+  for (uint64_t i = 0; i < loaded.getBlockCount(); ++i) {
+    BOOST_CHECK_EQUAL( loaded.getWeak(i), signature.getWeak(i) );
+    BOOST_CHECK( std::memcmp(loaded.getStrong(i), signature.getStrong(i),
+                             F_DELTA_STRONG_HASH_LEN) == 0 );
+  }
+  boost::filesystem::remove(path);
+}
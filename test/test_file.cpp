@@ -0,0 +1,59 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <sstream>
+
+#include "file.hpp"
+#include "path_codec.hpp"
+
+BOOST_AUTO_TEST_CASE(file_metadata_batch)
+{
+  boost::filesystem::path box_dir = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-file-%%%%-%%%%");
+  boost::filesystem::create_directories(box_dir / "dir");
+  {
+    boost::filesystem::ofstream ofs(box_dir / "dir" / "file");
+    ofs << "12345";
+  }
+  Hash box_hash;
+
+  // a directory, a file and a deletion in one batch with one codec
+  std::stringstream records;
+  {
+    PathCodec codec;
+    File dir(box_dir.string(), &box_hash, "/dir");
+    File file(box_dir.string(), &box_hash, "/dir/file");
+    File deleted(box_dir.string(), &box_hash, "/dir/gone", false, true);
+    dir.serialize(records, codec);
+    file.serialize(records, codec);
+    deleted.serialize(records, codec);
+  }
+  boost::filesystem::remove_all(box_dir / "dir");
+
+  PathCodec codec;
+  File dir(box_dir.string(), &box_hash);
+  File file(box_dir.string(), &box_hash);
+  File deleted(box_dir.string(), &box_hash);
+  dir.deserialize(records, codec);
+  file.deserialize(records, codec);
+  deleted.deserialize(records, codec);
+  BOOST_CHECK( !records.fail() );
+
+  BOOST_CHECK_EQUAL( dir.getPath(), "/dir" );
+  BOOST_CHECK( dir.getType() == boost::filesystem::directory_file );
+  BOOST_CHECK_EQUAL( file.getPath(), "/dir/file" );
+  BOOST_CHECK( file.getType() == boost::filesystem::regular_file );
+  BOOST_CHECK_EQUAL( file.getSize(), 5 );
+  BOOST_CHECK_EQUAL( deleted.getPath(), "/dir/gone" );
+  BOOST_CHECK( deleted.isToBeDeleted() );
+
+  // reading a batch leaves the disk alone, the entries are made on apply
+  BOOST_CHECK( !dir.exists() );
+  dir.create();
+  file.create();
+  BOOST_CHECK( dir.exists() );
+  BOOST_CHECK( file.exists() );
+
+  boost::filesystem::remove_all(box_dir);
+}
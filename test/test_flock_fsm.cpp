@@ -0,0 +1,44 @@
+#include <boost/test/unit_test.hpp>
+
+namespace fsm {
+  #include "flock_fsm.h"
+}
+namespace fsm_reference {
+  #include "flock_fsm_reference.h"
+}
+
+// the tables are usable at compile time
+static_assert(fsm::get_new_state(fsm::ready_state, fsm::new_local_file_event, fsm::status_300)
+                == fsm::announcing_new_file_state, "table lookup");
+
+BOOST_AUTO_TEST_CASE(flock_fsm_status_codes) {
+  // every value an enum of status_t may hold
+  for (int status = 0; status < 512; ++status) {
+    BOOST_REQUIRE_EQUAL(
+      fsm::get_event_by_status_code((fsm::status_t)status),
+      fsm_reference::get_event_by_status_code((fsm_reference::status_t)status));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(flock_fsm_transitions) {
+  for (int state = 0; state < 32; ++state) {
+    for (int event = 0; event < 32; ++event) {
+      for (int status = 0; status < 512; ++status) {
+        fsm::state_t s = (fsm::state_t)state;
+        fsm::event_t e = (fsm::event_t)event;
+        fsm::status_t c = (fsm::status_t)status;
+        fsm_reference::state_t rs = (fsm_reference::state_t)state;
+        fsm_reference::event_t re = (fsm_reference::event_t)event;
+        fsm_reference::status_t rc = (fsm_reference::status_t)status;
+        BOOST_REQUIRE_EQUAL(fsm::check_event(s, e, c),
+                            fsm_reference::check_event(rs, re, rc));
+        BOOST_REQUIRE_EQUAL(fsm::get_action(s, e, c),
+                            fsm_reference::get_action(rs, re, rc));
+        BOOST_REQUIRE_EQUAL(fsm::get_heartbeat_status(s, e, c),
+                            fsm_reference::get_heartbeat_status(rs, re, rc));
+        BOOST_REQUIRE_EQUAL(fsm::get_new_state(s, e, c),
+                            fsm_reference::get_new_state(rs, re, rc));
+      }
+    }
+  }
+}
@@ -0,0 +1,130 @@
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "frame.hpp"
+
+BOOST_AUTO_TEST_CASE(frame_roundtrip) {
+  unsigned char box[F_GENERIC_HASH_LEN];
+  unsigned char node[F_GENERIC_HASH_LEN];
+  for (size_t i = 0; i < F_GENERIC_HASH_LEN; ++i) {
+    box[i] = static_cast<unsigned char>(i);
+    node[i] = static_cast<unsigned char>(255 - i);
+  }
+
+  Frame frame(1, 131);
+  frame.setMore(true)
+       .setOp(3)
+       .setLane(1)
+       .setTimestamp(1456789012345ULL)
+       .setOffset(UINT64_MAX - 1)
+       .setLength(4096)
+       .setBox(box)
+       .setNode(node)
+       .putU8('R')
+       .putU32(2)
+       .putU64(0x0102030405060708ULL)
+       .putString("some/path");
+  size_t payload_size = 1 + 4 + 8 + 4 + 9;
+  BOOST_CHECK_EQUAL(frame.size(), F_FRAME_HEADER_LEN + payload_size);
+  frame.pad(512);
+  BOOST_CHECK_EQUAL(frame.size(), 512);
+
+  FrameView view(frame.data(), frame.size());
+  BOOST_REQUIRE(view.valid());
+  BOOST_CHECK_EQUAL(view.type(), 1);
+  BOOST_CHECK_EQUAL(view.status(), 131);
+  BOOST_CHECK(view.more());
+  BOOST_CHECK_EQUAL(view.op(), 3);
+  BOOST_CHECK_EQUAL(view.lane(), 1);
+  BOOST_CHECK_EQUAL(view.timestamp(), 1456789012345ULL);
+  BOOST_CHECK_EQUAL(view.offset(), UINT64_MAX - 1);
+  BOOST_CHECK_EQUAL(view.length(), 4096);
+  BOOST_CHECK(std::memcmp(view.box(), box, F_GENERIC_HASH_LEN) == 0);
+  BOOST_CHECK(std::memcmp(view.node(), node, F_GENERIC_HASH_LEN) == 0);
+  // the padding is not part of the payload
+  BOOST_CHECK_EQUAL(view.payloadSize(), payload_size);
+
+  PayloadReader payload(view);
+  BOOST_CHECK_EQUAL(payload.getU8(), 'R');
+  BOOST_CHECK_EQUAL(payload.getU32(), 2);
+  BOOST_CHECK_EQUAL(payload.getU64(), 0x0102030405060708ULL);
+  size_t length;
+  const char* path = payload.getString(length);
+  BOOST_CHECK_EQUAL(std::string(path, length), "some/path");
+  BOOST_CHECK_EQUAL(payload.remaining(), 0);
+  BOOST_CHECK(payload.ok());
+
+  // the copy keeps the header but drops the padding
+  Frame copy(view);
+  copy.setMore(false);
+  FrameView copy_view(copy.data(), copy.size());
+  BOOST_REQUIRE(copy_view.valid());
+  BOOST_CHECK_EQUAL(copy.size(), F_FRAME_HEADER_LEN + payload_size);
+  BOOST_CHECK(!copy_view.more());
+  BOOST_CHECK_EQUAL(copy_view.status(), 131);
+
+  // payloads are read in place
+  const char record[] = "record\0with\0zeros";
+  MemoryInputStream stream(record, sizeof(record));
+  char buffer[sizeof(record)];
+  stream.read(buffer, sizeof(record));
+  BOOST_CHECK_EQUAL(stream.gcount(), static_cast<std::streamsize>(sizeof(record)));
+  BOOST_CHECK(std::memcmp(buffer, record, sizeof(record)) == 0);
+  stream.seekg(7);
+  BOOST_CHECK_EQUAL(stream.get(), 'w');
+}
+
+BOOST_AUTO_TEST_CASE(frame_malformed) {
+  Frame frame(0, 1);
+  frame.putU32(7);
+
+  // too short, wrong magic or a payload beyond the data
+  BOOST_CHECK(!FrameView(frame.data(), F_FRAME_HEADER_LEN - 1).valid());
+  BOOST_CHECK(!FrameView(frame.data(), frame.size() - 1).valid());
+  std::string corrupt(frame.data(), frame.size());
+  corrupt[0] = 'x';
+  BOOST_CHECK(!FrameView(corrupt.data(), corrupt.size()).valid());
+  BOOST_CHECK(!FrameView(nullptr, 0).valid());
+
+  // reads past the payload fail instead of running into the padding
+  frame.pad(F_FRAME_HEADER_LEN + 64);
+  FrameView view(frame.data(), frame.size());
+  BOOST_REQUIRE(view.valid());
+  PayloadReader payload(view);
+  BOOST_CHECK_EQUAL(payload.getU32(), 7);
+  BOOST_CHECK_EQUAL(payload.getU64(), 0);
+  BOOST_CHECK(!payload.ok());
+  size_t length;
+  BOOST_CHECK(payload.getString(length) == nullptr);
+  BOOST_CHECK_EQUAL(length, 0);
+}
+
+BOOST_AUTO_TEST_CASE(frame_pooled_buffers) {
+  BufferPool* pool = BufferPool::getInstance();
+  { Frame warmup(0, 1); }
+  size_t allocated = pool->allocated();
+  size_t available = pool->available();
+
+  // frames, moved ones and buffers handed over and given back reuse 
+  // the same buffer once the pool is warm
+  for (int i = 0; i < 100; ++i) {
+    Frame frame(F_FRAME_VERSION, i);
+    frame.putU64(i).pad(F_FRAME_HEADER_LEN + 512);
+    Frame moved(std::move(frame));
+    BOOST_CHECK_EQUAL(FrameView(moved.data(), moved.size()).status(), i);
+    BufferPool::release(moved.release(), moved.pool());
+  }
+  BOOST_CHECK_EQUAL(pool->allocated(), allocated);
+  BOOST_CHECK_EQUAL(pool->available(), available);
+
+  // a payload beyond the buffer is refused instead of reallocated
+  Frame frame(0, 1);
+  std::string large(F_FRAME_BUFFER_SIZE, 'x');
+  BOOST_CHECK_THROW(frame.putBytes(large.data(), large.size()), std::length_error);
+  BOOST_CHECK_THROW(frame.pad(F_FRAME_BUFFER_SIZE + 1), std::length_error);
+  BOOST_CHECK_EQUAL(frame.size(), F_FRAME_HEADER_LEN);
+}
@@ -0,0 +1,30 @@
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+#include "id_registry.hpp"
+
+BOOST_AUTO_TEST_CASE(id_registry_intern)
+{
+  IdRegistry registry;
+  unsigned char id[F_GENERIC_HASH_LEN] = {0};
+  BOOST_CHECK_EQUAL( registry.find(id), -1 );
+
+  // ids that only differ in their last byte, enough to grow the table
+  for (uint32_t i = 0; i < 100; ++i) {
+    id[F_GENERIC_HASH_LEN - 1] = static_cast<unsigned char>(i);
+    BOOST_CHECK_EQUAL( registry.intern(id), i );
+  }
+  BOOST_CHECK_EQUAL( registry.size(), 100 );
+
+  for (uint32_t i = 0; i < 100; ++i) {
+    id[F_GENERIC_HASH_LEN - 1] = static_cast<unsigned char>(i);
+    BOOST_CHECK_EQUAL( registry.find(id), static_cast<int>(i) );
+    BOOST_CHECK_EQUAL( registry.intern(id), i );
+    BOOST_CHECK( std::memcmp(registry.get(i), id, F_GENERIC_HASH_LEN) == 0 );
+  }
+  BOOST_CHECK_EQUAL( registry.size(), 100 );
+
+  id[0] = 1;
+  BOOST_CHECK_EQUAL( registry.find(id), -1 );
+}
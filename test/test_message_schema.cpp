@@ -0,0 +1,153 @@
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <cstring>
+
+#include "message_schema.hpp"
+
+BOOST_AUTO_TEST_CASE(message_schema_announcement) {
+  unsigned char content_hash[F_GENERIC_HASH_LEN];
+  for (size_t i = 0; i < F_GENERIC_HASH_LEN; ++i)
+    content_hash[i] = static_cast<unsigned char>(i * 3);
+  std::string record("some record");
+
+  msg::FileAnnouncement announcement;
+  announcement.deadline = 1456789012345ULL;
+  announcement.content_hash = content_hash;
+  announcement.holes.push_back(std::make_pair(65536, 131072));
+  announcement.holes.push_back(std::make_pair(1048576, 65536));
+  announcement.record = record.data();
+  announcement.record_length = record.size();
+
+  Frame frame(F_SIGTYPE_PUB, fsm::status_130);
+  announcement.encode(frame);
+  BOOST_CHECK_EQUAL(frame.size(), F_FRAME_HEADER_LEN
+                                + msg::FileAnnouncement::fixed_size
+                                + 2 * msg::range_len + record.size());
+  frame.pad(F_HEARTBEAT_LEN);
+
+  FrameView view(frame.data(), frame.size());
+  msg::FileAnnouncement decoded;
+  BOOST_REQUIRE(msg::decode<fsm::status_130>(view, decoded));
+  BOOST_CHECK_EQUAL(decoded.deadline, announcement.deadline);
+  BOOST_CHECK(std::memcmp(decoded.content_hash, content_hash, F_GENERIC_HASH_LEN) == 0);
+  BOOST_CHECK(decoded.holes == announcement.holes);
+  BOOST_CHECK_EQUAL(std::string(decoded.record, decoded.record_length), record);
+
+  // a payload shorter than its hole count says is rejected
+  Frame truncated(F_SIGTYPE_PUB, fsm::status_130);
+  truncated.putBytes(frame.data() + F_FRAME_HEADER_LEN, msg::FileAnnouncement::fixed_size + 8);
+  BOOST_CHECK(!decoded.decode(FrameView(truncated.data(), truncated.size())));
+}
+
+BOOST_AUTO_TEST_CASE(message_schema_resume_reply) {
+  msg::ResumeReply ranges;
+  ranges.tag = 'R';
+  ranges.ranges.push_back(std::make_pair(0, 4096));
+  ranges.ranges.push_back(std::make_pair(8192, 16384));
+  Frame ranges_frame(F_SIGTYPE_PUB, fsm::status_131);
+  ranges.encode(ranges_frame);
+
+  msg::ResumeReply decoded;
+  BOOST_REQUIRE(msg::decode<fsm::status_131>(
+    FrameView(ranges_frame.data(), ranges_frame.size()), decoded));
+  BOOST_CHECK_EQUAL(decoded.tag, 'R');
+  BOOST_CHECK(decoded.ranges == ranges.ranges);
+
+  unsigned char base[F_GENERIC_HASH_LEN];
+  std::memset(base, 0xab, F_GENERIC_HASH_LEN);
+  msg::ResumeReply delta;
+  delta.tag = 'D';
+  delta.base = base;
+  delta.in_place = false;
+  Frame delta_frame(F_SIGTYPE_PUB, fsm::status_131);
+  delta.encode(delta_frame);
+  BOOST_CHECK_EQUAL(delta_frame.size(), F_FRAME_HEADER_LEN + msg::ResumeReply::delta_size);
+  BOOST_REQUIRE(msg::decode<fsm::status_131>(
+    FrameView(delta_frame.data(), delta_frame.size()), decoded));
+  BOOST_CHECK_EQUAL(decoded.tag, 'D');
+  BOOST_CHECK(std::memcmp(decoded.base, base, F_GENERIC_HASH_LEN) == 0);
+  BOOST_CHECK(!decoded.in_place);
+
+  // the status of the frame has to match the payload
+  Frame other(F_SIGTYPE_PUB, fsm::status_130);
+  delta.encode(other);
+  BOOST_CHECK(!msg::decode<fsm::status_131>(FrameView(other.data(), other.size()), decoded));
+
+  Frame unknown(F_SIGTYPE_PUB, fsm::status_131);
+  unknown.putU8('X');
+  BOOST_CHECK(!msg::decode<fsm::status_131>(FrameView(unknown.data(), unknown.size()), decoded));
+}
+
+BOOST_AUTO_TEST_CASE(message_schema_heartbeat_length) {
+  // the largest payloads the boxoffice hands to the heartbeater
+  Frame idle(F_SIGTYPE_PUB, fsm::status_100);
+
+  unsigned char content_hash[F_GENERIC_HASH_LEN] = {};
+  std::string record(msg::FileAnnouncement::maximum_record_length
+                     - 3 * msg::range_len, 'r');
+  msg::FileAnnouncement announcement;
+  announcement.deadline = 1456789012345ULL;
+  announcement.content_hash = content_hash;
+  for (size_t i = 0; i < msg::FileAnnouncement::maximumHoles(record.size()); ++i)
+    announcement.holes.push_back(std::make_pair(i * 131072, 65536));
+  BOOST_CHECK_EQUAL(announcement.holes.size(), 3);
+  announcement.record = record.data();
+  announcement.record_length = record.size();
+  Frame announce(F_SIGTYPE_PUB, fsm::status_130);
+  announcement.encode(announce);
+
+  msg::ResumeReply reply;
+  reply.tag = 'R';
+  for (size_t i = 0; i < F_MAXIMUM_RESUME_RANGES; ++i)
+    reply.ranges.push_back(std::make_pair(i * 8192, i * 8192 + 4096));
+  Frame resume(F_SIGTYPE_PUB, fsm::status_131);
+  reply.encode(resume);
+
+  std::string records(msg::MetadataChange::maximum_records_length, 'm');
+  msg::MetadataChange change = { F_METADATA_BATCH_SIZE, records.data(), records.size() };
+  Frame batch(F_SIGTYPE_PUB, fsm::status_174);
+  change.encode(batch);
+
+  Frame* heartbeats[] = { &idle, &announce, &resume, &batch };
+  for (size_t i = 0; i < 4; ++i) {
+    BOOST_REQUIRE(msg::sealHeartbeat(*heartbeats[i]));
+    BOOST_CHECK_EQUAL(heartbeats[i]->size(), F_HEARTBEAT_LEN);
+  }
+  BOOST_REQUIRE(msg::decode<fsm::status_130>(
+    FrameView(announce.data(), announce.size()), announcement));
+  BOOST_CHECK_EQUAL(announcement.record_length, record.size());
+
+  // a payload that does not fit is refused rather than sent longer
+  Frame oversized(F_SIGTYPE_PUB, fsm::status_174);
+  records.push_back('m');
+  change.records = records.data();
+  change.records_length = records.size();
+  change.encode(oversized);
+  BOOST_CHECK(!msg::sealHeartbeat(oversized));
+  BOOST_CHECK_EQUAL(oversized.size(), F_HEARTBEAT_LEN + 1);
+}
+
+BOOST_AUTO_TEST_CASE(message_schema_metadata_batch) {
+  std::string records("first record, second record");
+  msg::MetadataChange change = { 2, records.data(), records.size() };
+  Frame frame(F_SIGTYPE_PUB, fsm::status_174);
+  change.encode(frame);
+  BOOST_CHECK_EQUAL(frame.size(), F_FRAME_HEADER_LEN
+                                + msg::MetadataChange::fixed_size + records.size());
+
+  msg::MetadataChange decoded;
+  BOOST_REQUIRE(msg::decode<fsm::status_174>(FrameView(frame.data(), frame.size()), decoded));
+  BOOST_CHECK_EQUAL(decoded.count, 2);
+  BOOST_CHECK_EQUAL(std::string(decoded.records, decoded.records_length), records);
+
+  // empty batches and batches larger than allowed are rejected
+  change.count = 0;
+  Frame empty(F_SIGTYPE_PUB, fsm::status_170);
+  change.encode(empty);
+  BOOST_CHECK(!msg::decode<fsm::status_170>(FrameView(empty.data(), empty.size()), decoded));
+  change.count = F_METADATA_BATCH_SIZE + 1;
+  Frame oversized(F_SIGTYPE_PUB, fsm::status_170);
+  change.encode(oversized);
+  BOOST_CHECK(!msg::decode<fsm::status_170>(FrameView(oversized.data(), oversized.size()), decoded));
+}
@@ -0,0 +1,96 @@
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "path_codec.hpp"
+#include "small_string.hpp"
+
+BOOST_AUTO_TEST_CASE(path_codec_roundtrip) {
+  std::string long_path;
+  while (long_path.size() < 1000)
+    long_path += "some/deeply/nested/directory/";
+  long_path += "file";
+
+  std::vector<std::string> paths = { "a", "", long_path, "dir/file with spaces" };
+  for (std::vector<std::string>::iterator i = paths.begin(); i != paths.end(); ++i) {
+    std::stringstream stream;
+    PathCodec encoder;
+    encoder.encode(stream, *i);
+    // no padding, only the two length prefixes
+    BOOST_CHECK_EQUAL(stream.str().size(), i->size() + (i->size() < 128 ? 2 : 3));
+
+    PathCodec decoder;
+    std::string path;
+    BOOST_CHECK(decoder.decode(stream, path));
+    BOOST_CHECK_EQUAL(path, *i);
+  }
+
+  // truncated records and paths beyond the limit are rejected
+  std::stringstream truncated;
+  PathCodec::writeVarint(truncated, 0);
+  PathCodec::writeVarint(truncated, 10);
+  truncated << "short";
+  PathCodec decoder;
+  std::string path;
+  BOOST_CHECK(!decoder.decode(truncated, path));
+
+  std::stringstream too_long;
+  PathCodec::writeVarint(too_long, 0);
+  PathCodec::writeVarint(too_long, F_MAXIMUM_PATH_LENGTH + 1);
+  BOOST_CHECK(!decoder.decode(too_long, path));
+
+  // a suffix that wraps around with the shared prefix is no way around it
+  std::stringstream wrapping;
+  PathCodec::writeVarint(wrapping, 0);
+  PathCodec::writeVarint(wrapping, 1);
+  wrapping << "a";
+  PathCodec::writeVarint(wrapping, 1);
+  PathCodec::writeVarint(wrapping, UINT64_MAX);
+  PathCodec wrapped;
+  BOOST_CHECK(wrapped.decode(wrapping, path));
+  BOOST_CHECK(!wrapped.decode(wrapping, path));
+}
+
+BOOST_AUTO_TEST_CASE(path_codec_prefix) {
+  std::vector<std::string> paths = {
+    "photos/2016/january/img_0001.jpg",
+    "photos/2016/january/img_0002.jpg",
+    "photos/2016/february/img_0003.jpg",
+    "music/track.ogg"
+  };
+
+  std::stringstream stream;
+  PathCodec encoder;
+  for (std::vector<std::string>::iterator i = paths.begin(); i != paths.end(); ++i)
+    encoder.encode(stream, *i);
+  // the second path only carries "2.jpg", the third "february/img_0003.jpg"
+  BOOST_CHECK_EQUAL(stream.str().size(), (2 + 32) + (2 + 5) + (2 + 21) + (2 + 15));
+
+  PathCodec decoder;
+  for (std::vector<std::string>::iterator i = paths.begin(); i != paths.end(); ++i) {
+    std::string path;
+    BOOST_CHECK(decoder.decode(stream, path));
+    BOOST_CHECK_EQUAL(path, *i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(small_string_storage) {
+  SmallString<16> s(std::string("short"));
+  BOOST_CHECK(s.isInline());
+  BOOST_CHECK_EQUAL(s.str(), "short");
+
+  s = std::string("a string longer than sixteen characters");
+  BOOST_CHECK(!s.isInline());
+  BOOST_CHECK_EQUAL(std::string(s.c_str()), "a string longer than sixteen characters");
+
+  SmallString<16> copy(s);
+  BOOST_CHECK_EQUAL(copy.str(), s.str());
+  BOOST_CHECK(copy.c_str() != s.c_str());
+
+  s = std::string("back inline");
+  BOOST_CHECK(s.isInline());
+  BOOST_CHECK_EQUAL(s.size(), 11);
+  BOOST_CHECK_EQUAL(copy.size(), 39);
+}
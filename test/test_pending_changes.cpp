@@ -0,0 +1,41 @@
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include "pending_changes.hpp"
+#include "file.hpp"
+
+BOOST_AUTO_TEST_CASE(pending_changes_merge)
+{
+  std::vector<File*> files;
+  for (int i = 0; i < 4; ++i)
+    files.push_back(new File("/tmp", nullptr, i == 2 ? "/a" : "/b", false, i == 3));
+
+  PendingChanges pending;
+  BOOST_CHECK( pending.empty() );
+  BOOST_CHECK( pending.push_back(files[0]) == nullptr );
+  BOOST_CHECK( pending.push_back(files[1]) == files[0] );
+  BOOST_CHECK( pending.push_back(files[2]) == nullptr );
+  BOOST_CHECK_EQUAL( pending.size(), 2 );
+
+  // the later change of /b keeps the place of the earlier one
+  BOOST_CHECK( pending.front() == files[1] );
+  BOOST_CHECK( !pending.push_front(files[0]) );
+  std::vector<File*> order(pending.begin(), pending.end());
+  BOOST_REQUIRE_EQUAL( order.size(), 2 );
+  BOOST_CHECK( order[1] == files[2] );
+
+  BOOST_CHECK( pending.cancel("/b", true) == nullptr );
+  BOOST_CHECK( pending.cancel("/b") == files[1] );
+  BOOST_CHECK( !pending.has("/b") );
+  BOOST_CHECK( pending.cancel("/b") == nullptr );
+  BOOST_CHECK( pending.push_front(files[3]) );
+  BOOST_CHECK( pending.front() == files[3] );
+  pending.pop_front();
+  pending.pop_front();
+  BOOST_CHECK( pending.empty() );
+  BOOST_CHECK( !pending.has("/a") );
+
+  for (std::vector<File*>::iterator i = files.begin(); i != files.end(); ++i)
+    delete *i;
+}
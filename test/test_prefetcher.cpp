@@ -0,0 +1,81 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <cstdlib>
+
+#include "prefetcher.hpp"
+
+namespace {
+  std::string makeContent(size_t length) {
+    std::string content(length, '\0');
+    std::srand(7);
+    for (size_t i = 0; i < length; ++i)
+      content[i] = static_cast<char>(std::rand() & 0xff);
+    return content;
+  }
+
+  boost::filesystem::path writeTemporaryFile(const std::string& content) {
+    boost::filesystem::path path = boost::filesystem::temp_directory_path()
+      / boost::filesystem::unique_path("flocksy-prefetcher-%%%%-%%%%");
+    std::ofstream out(path.string(), std::ios::binary);
+    out << content;
+    return path;
+  }
+
+  std::string readAll(Prefetcher& prefetcher, uint64_t offset, uint64_t end, size_t step) {
+    std::string result;
+    std::vector<char> buffer(step);
+    while (offset < end) {
+      ssize_t r = prefetcher.read(buffer.data(), std::min<uint64_t>(step, end - offset), offset);
+      if (r <= 0) break;
+      result.append(buffer.data(), r);
+      offset += r;
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(prefetcher_sequential) {
+  // more than the ring holds, with a last block that is not full
+  const size_t size = (F_PREFETCH_DEPTH * 3 + 1) * F_PREFETCH_BLOCK_SIZE + 1234;
+  std::string content = makeContent(size);
+  boost::filesystem::path path = writeTemporaryFile(content);
+  int fd = ::open(path.c_str(), O_RDONLY);
+
+  std::vector< std::pair<uint64_t, uint64_t> > ranges;
+  ranges.push_back(std::make_pair(100, 300000));
+  ranges.push_back(std::make_pair(500000, size));
+  Prefetcher prefetcher(fd, ranges);
+  // reads that do not line up with the blocks
+  BOOST_CHECK(readAll(prefetcher, 100, 300000, 10000) == content.substr(100, 299900));
+  BOOST_CHECK(readAll(prefetcher, 500000, size, 7777) == content.substr(500000));
+  prefetcher.stop();
+
+  ::close(fd);
+  boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(prefetcher_out_of_order) {
+  const size_t size = 4 * F_PREFETCH_BLOCK_SIZE;
+  std::string content = makeContent(size);
+  boost::filesystem::path path = writeTemporaryFile(content);
+  int fd = ::open(path.c_str(), O_RDONLY);
+
+  Prefetcher prefetcher(fd, std::vector< std::pair<uint64_t, uint64_t> >(
+                              1, std::make_pair(0, size)));
+  // skipping ahead drops the blocks in between, going back reads directly
+  BOOST_CHECK(readAll(prefetcher, 2 * F_PREFETCH_BLOCK_SIZE, size, 4096)
+              == content.substr(2 * F_PREFETCH_BLOCK_SIZE));
+  BOOST_CHECK(readAll(prefetcher, 10, 5000, 4096) == content.substr(10, 4990));
+  prefetcher.stop();
+  BOOST_CHECK(readAll(prefetcher, 0, size, 65536) == content);
+
+  ::close(fd);
+  boost::filesystem::remove(path);
+}
@@ -0,0 +1,115 @@
+#include <boost/test/unit_test.hpp>
+
+#include <zmqpp/zmqpp.hpp>
+#include <string>
+#include <vector>
+
+#include "reactor.hpp"
+
+namespace {
+  void send(zmqpp::socket& socket, const std::string& text) {
+    zmqpp::message z_msg;
+    z_msg << text;
+    socket.send(z_msg);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(reactor_receive) {
+  zmqpp::context z_ctx;
+  zmqpp::socket broadcast_in(z_ctx, zmqpp::socket_type::pair);
+  zmqpp::socket broadcast_out(z_ctx, zmqpp::socket_type::pair);
+  zmqpp::socket data_in(z_ctx, zmqpp::socket_type::pair);
+  zmqpp::socket data_out(z_ctx, zmqpp::socket_type::pair);
+  broadcast_in.bind("inproc://reactor_broadcast");
+  broadcast_out.connect("inproc://reactor_broadcast");
+  data_in.bind("inproc://reactor_data");
+  data_out.connect("inproc://reactor_data");
+
+  Reactor reactor;
+  BOOST_CHECK_EQUAL(reactor.add(broadcast_in), 0);
+  BOOST_CHECK_EQUAL(reactor.add(data_in), 1);
+
+  zmqpp::message z_msg;
+  BOOST_CHECK_EQUAL(reactor.receive(z_msg, 0), -1);
+
+  // everything ready is drained in order of the sources, so the
+  // broadcast comes first although it was sent last
+  send(data_out, "one");
+  send(data_out, "two");
+  send(broadcast_out, "stop");
+  std::vector<std::string> received;
+  std::vector<int> sources;
+  for (int source = reactor.receive(z_msg, 100); source >= 0;
+       source = reactor.receive(z_msg, 0)) {
+    sources.push_back(source);
+    received.push_back(z_msg.get(0));
+  }
+  BOOST_REQUIRE_EQUAL(received.size(), 3);
+  BOOST_CHECK_EQUAL(sources[0], 0);
+  BOOST_CHECK_EQUAL(received[0], "stop");
+  BOOST_CHECK_EQUAL(received[1], "one");
+  BOOST_CHECK_EQUAL(received[2], "two");
+
+  broadcast_in.close();
+  broadcast_out.close();
+  data_in.close();
+  data_out.close();
+}
+
+BOOST_AUTO_TEST_CASE(reactor_handlers) {
+  zmqpp::context z_ctx;
+  zmqpp::socket data_in(z_ctx, zmqpp::socket_type::pair);
+  zmqpp::socket data_out(z_ctx, zmqpp::socket_type::pair);
+  data_in.bind("inproc://reactor_handlers");
+  data_out.connect("inproc://reactor_handlers");
+
+  // the handler stops the reactor, messages behind that stay queued
+  int handled = 0;
+  Reactor reactor;
+  reactor.add(data_in, [&](zmqpp::message& z_msg) {
+    ++handled;
+    return z_msg.get(0) != "stop";
+  });
+  send(data_out, "one");
+  send(data_out, "stop");
+  send(data_out, "two");
+  reactor.run();
+  BOOST_CHECK_EQUAL(handled, 2);
+
+  zmqpp::message z_msg;
+  BOOST_CHECK_EQUAL(reactor.receive(z_msg, 100), 0);
+  BOOST_CHECK_EQUAL(z_msg.get(0), "two");
+
+  data_in.close();
+  data_out.close();
+}
+
+BOOST_AUTO_TEST_CASE(reactor_channel) {
+  zmqpp::context z_ctx;
+  zmqpp::socket broadcast_in(z_ctx, zmqpp::socket_type::pair);
+  zmqpp::socket broadcast_out(z_ctx, zmqpp::socket_type::pair);
+  broadcast_in.bind("inproc://reactor_channel");
+  broadcast_out.connect("inproc://reactor_channel");
+
+  FrameChannel channel;
+  Reactor reactor;
+  reactor.add(broadcast_in);
+  BOOST_CHECK_EQUAL(reactor.add(channel), 1);
+
+  zmqpp::message z_msg;
+  FrameView frame;
+  BOOST_CHECK_EQUAL(reactor.receive(z_msg, frame, 0), -1);
+
+  // frames come out of the channel as they were pushed
+  for (int32_t status = 1; status <= 3; ++status)
+    s_send(channel, Frame(F_SIGTYPE_FSM, status));
+  for (int32_t status = 1; status <= 3; ++status) {
+    BOOST_REQUIRE_EQUAL(reactor.receive(z_msg, frame, 100), 1);
+    BOOST_CHECK(frame.valid());
+    BOOST_CHECK_EQUAL(frame.status(), status);
+  }
+  BOOST_CHECK_EQUAL(reactor.receive(z_msg, frame, 0), -1);
+
+  broadcast_in.close();
+  broadcast_out.close();
+}
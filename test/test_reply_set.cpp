@@ -0,0 +1,23 @@
+#include <boost/test/unit_test.hpp>
+
+#include "reply_set.hpp"
+
+BOOST_AUTO_TEST_CASE(reply_set_round)
+{
+  ReplySet replied;
+  BOOST_CHECK_EQUAL( replied.size(), 0 );
+  BOOST_CHECK( !replied.has(70) );
+
+  // repeated heartbeats of a node count once
+  BOOST_CHECK( replied.insert(0) );
+  BOOST_CHECK( replied.insert(70) );
+  BOOST_CHECK( !replied.insert(70) );
+  BOOST_CHECK_EQUAL( replied.size(), 2 );
+  BOOST_CHECK( replied.has(70) );
+  BOOST_CHECK( !replied.has(6) );
+
+  replied.clear();
+  BOOST_CHECK_EQUAL( replied.size(), 0 );
+  BOOST_CHECK( !replied.has(70) );
+  BOOST_CHECK( replied.insert(70) );
+}
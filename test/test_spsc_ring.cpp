@@ -0,0 +1,61 @@
+#include <boost/test/unit_test.hpp>
+
+#include <poll.h>
+#include <thread>
+
+#include "spsc_ring.hpp"
+
+namespace {
+  bool readable(const int fd) {
+    struct pollfd item = { fd, POLLIN, 0 };
+    return poll(&item, 1, 0) == 1;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(spsc_ring_order) {
+  SpscRing<int, 4> ring;
+  int value = 0;
+  BOOST_CHECK(ring.empty());
+  BOOST_CHECK(!ring.pop(value));
+  BOOST_CHECK(!readable(ring.fd()));
+
+  // only the push into the empty ring wakes the consumer
+  for (int i = 1; i <= 4; ++i)
+    BOOST_CHECK(ring.push(std::move(i)));
+  BOOST_CHECK(!ring.push(5));
+  BOOST_CHECK(readable(ring.fd()));
+  ring.clearWakeup();
+  BOOST_CHECK(!readable(ring.fd()));
+
+  for (int i = 1; i <= 4; ++i) {
+    BOOST_REQUIRE(ring.pop(value));
+    BOOST_CHECK_EQUAL(value, i);
+  }
+  BOOST_CHECK(ring.empty());
+
+  BOOST_CHECK(ring.push(6));
+  BOOST_CHECK(readable(ring.fd()));
+}
+
+BOOST_AUTO_TEST_CASE(spsc_ring_threads) {
+  const int count = 100000;
+  SpscRing<int, 64> ring;
+  std::thread producer([&]() {
+    for (int i = 0; i < count; ++i) {
+      int value = i;
+      while ( !ring.push(std::move(value)) ) std::this_thread::yield();
+    }
+  });
+
+  int value = 0;
+  int expected = 0;
+  bool ordered = true;
+  while (expected < count) {
+    if ( !ring.pop(value) ) continue;
+    ordered = ordered && value == expected;
+    ++expected;
+  }
+  producer.join();
+  BOOST_CHECK(ordered);
+  BOOST_CHECK(ring.empty());
+}
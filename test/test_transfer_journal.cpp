@@ -0,0 +1,78 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include "transfer_journal.hpp"
+#include "constants.hpp"
+
+BOOST_AUTO_TEST_CASE(transfer_journal_resume)
+{
+  boost::filesystem::path journal_dir = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-journal-%%%%-%%%%");
+  unsigned char box_hash[F_GENERIC_HASH_LEN] = {1};
+  unsigned char content_hash[F_GENERIC_HASH_LEN] = {2};
+  const uint64_t size = 3*F_MAXIMUM_FILE_PACKAGE_SIZE + 10;
+
+  {
+    TransferJournal journal(journal_dir.string(), box_hash, "some/file");
+    BOOST_CHECK( !journal.open(size, 1234, content_hash) );
+    BOOST_CHECK_EQUAL( journal.getChunkCount(), 4 );
+    BOOST_CHECK_EQUAL( journal.getMissingChunkCount(), 4 );
+
+    // a partial chunk does not count until it is complete
+    journal.markRange(0, F_MAXIMUM_FILE_PACKAGE_SIZE/2);
+    BOOST_CHECK( !journal.hasChunk(0) );
+    journal.markRange(F_MAXIMUM_FILE_PACKAGE_SIZE/2,
+                      F_MAXIMUM_FILE_PACKAGE_SIZE - F_MAXIMUM_FILE_PACKAGE_SIZE/2);
+    BOOST_CHECK( journal.hasChunk(0) );
+    journal.markRange(3*F_MAXIMUM_FILE_PACKAGE_SIZE, 10);
+    BOOST_CHECK( journal.hasChunk(3) );
+  }
+
+  // same identity: the bitmap survives
+  {
+    TransferJournal journal(journal_dir.string(), box_hash, "some/file");
+    BOOST_CHECK( journal.open(size, 1234, content_hash) );
+    BOOST_CHECK_EQUAL( journal.getMissingChunkCount(), 2 );
+    std::vector< std::pair<uint64_t, uint64_t> > ranges = journal.getMissingRanges(F_MAXIMUM_RESUME_RANGES);
+    BOOST_REQUIRE_EQUAL( ranges.size(), 1 );
+    BOOST_CHECK_EQUAL( ranges[0].first, F_MAXIMUM_FILE_PACKAGE_SIZE );
+    BOOST_CHECK_EQUAL( ranges[0].second, 3*F_MAXIMUM_FILE_PACKAGE_SIZE );
+  }
+
+  // a different version of the file starts over
+  {
+    TransferJournal journal(journal_dir.string(), box_hash, "some/file");
+    BOOST_CHECK( !journal.open(size, 4321, content_hash) );
+    BOOST_CHECK_EQUAL( journal.getMissingChunkCount(), 4 );
+    journal.markRange(0, size);
+    BOOST_CHECK( journal.complete() );
+    journal.remove();
+  }
+
+  boost::filesystem::remove_all(journal_dir);
+}
+
+BOOST_AUTO_TEST_CASE(transfer_journal_missing_ranges)
+{
+  boost::filesystem::path journal_dir = boost::filesystem::temp_directory_path()
+    / boost::filesystem::unique_path("flocksy-journal-%%%%-%%%%");
+  unsigned char box_hash[F_GENERIC_HASH_LEN] = {1};
+  unsigned char content_hash[F_GENERIC_HASH_LEN] = {2};
+  const uint64_t size = 8*F_MAXIMUM_FILE_PACKAGE_SIZE;
+
+  TransferJournal journal(journal_dir.string(), box_hash, "other/file");
+  journal.open(size, 1, content_hash);
+  for (uint64_t i = 0; i < 8; i += 2)
+    journal.markRange(i*F_MAXIMUM_FILE_PACKAGE_SIZE, F_MAXIMUM_FILE_PACKAGE_SIZE);
+
+  // four gaps, but only two ranges allowed: the last one extends to EOF
+  std::vector< std::pair<uint64_t, uint64_t> > ranges = journal.getMissingRanges(2);
+  BOOST_REQUIRE_EQUAL( ranges.size(), 2 );
+  BOOST_CHECK_EQUAL( ranges[0].first, 1*F_MAXIMUM_FILE_PACKAGE_SIZE );
+  BOOST_CHECK_EQUAL( ranges[0].second, 2*F_MAXIMUM_FILE_PACKAGE_SIZE );
+  BOOST_CHECK_EQUAL( ranges[1].first, 3*F_MAXIMUM_FILE_PACKAGE_SIZE );
+  BOOST_CHECK_EQUAL( ranges[1].second, size );
+
+  journal.remove();
+  boost::filesystem::remove_all(journal_dir);
+}